@@ -0,0 +1,535 @@
+#include "InoCore.h"
+#include "AsyncFileOutStream.h"
+
+#ifdef INO_HOST
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define INO_ASYNCFILEOUTSTREAM_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Writes full buffers asynchronously. Owns the buffers, one is being filled by the stream and the others are free or in flight.
+	 */
+	class AsyncFileOutStream::Backend
+	{
+	protected:
+		std::vector<char*> Buffers;
+		std::vector<char*> FreeBuffers;
+		unsigned int MaxInFlight;
+
+	public:
+		std::atomic<bool> Failed{false};
+
+		Backend(size_t BufferSize, unsigned int MaxInFlight) : MaxInFlight(MaxInFlight)
+		{
+			for (unsigned int B = 0; B <= MaxInFlight; B++)
+				Buffers.push_back(new char[BufferSize]);
+			FreeBuffers.assign(Buffers.rbegin(), Buffers.rend());
+		}
+
+		virtual ~Backend()
+		{
+			for (char* Buffer : Buffers)
+				delete[] Buffer;
+		}
+
+		char* TakeFirst()
+		{
+			char* Buffer = FreeBuffers.back();
+			FreeBuffers.pop_back();
+			return Buffer;
+		}
+
+		virtual bool IsUring() const { return false; }
+
+		/**
+		 * @brief Starts writing `Buffer` and returns a free buffer. Waits first if `MaxInFlight` buffers are in flight already, then a free buffer is always left.
+		 */
+		virtual char* Submit(char* Buffer, size_t Length) = 0;
+
+		/**
+		 * @brief Waits until all submitted buffers are written.
+		 */
+		virtual void Wait() = 0;
+	};
+
+	namespace {
+
+		bool WriteAll(int Fd, const char* Data, size_t Length)
+		{
+			while (Length)
+			{
+				ssize_t Written = ::write(Fd, Data, Length);
+				if (Written < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					return false;
+				}
+				Data += Written;
+				Length -= Written;
+			}
+			return true;
+		}
+
+		class ThreadBackend : public AsyncFileOutStream::Backend
+		{
+		private:
+			int Fd;
+			std::mutex Mutex;
+			std::condition_variable Changed;
+			std::deque<std::pair<char*, size_t>> Queue;
+			size_t Pending = 0;
+			bool Stop = false;
+			std::thread Writer;
+
+			void Run()
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				while (true)
+				{
+					Changed.wait(Lock, [this] { return Stop || !Queue.empty(); });
+					if (Queue.empty())
+						return;
+					std::pair<char*, size_t> Job = Queue.front();
+					Queue.pop_front();
+					Lock.unlock();
+					if (!WriteAll(Fd, Job.first, Job.second))
+						Failed.store(true, std::memory_order_relaxed);
+					Lock.lock();
+					FreeBuffers.push_back(Job.first);
+					Pending--;
+					Changed.notify_all();
+				}
+			}
+
+		public:
+			ThreadBackend(int Fd, size_t BufferSize, unsigned int MaxInFlight) : Backend(BufferSize, MaxInFlight), Fd(Fd)
+			{
+				Writer = std::thread(&ThreadBackend::Run, this);
+			}
+
+			~ThreadBackend()
+			{
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Stop = true;
+				}
+				Changed.notify_all();
+				Writer.join();
+			}
+
+			virtual char* Submit(char* Buffer, size_t Length) override
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Changed.wait(Lock, [this] { return Pending < MaxInFlight; });
+				Queue.emplace_back(Buffer, Length);
+				Pending++;
+				Changed.notify_all();
+				Changed.wait(Lock, [this] { return !FreeBuffers.empty(); });
+				char* Free = FreeBuffers.back();
+				FreeBuffers.pop_back();
+				return Free;
+			}
+
+			virtual void Wait() override
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Changed.wait(Lock, [this] { return Pending == 0; });
+			}
+		};
+
+#ifdef INO_ASYNCFILEOUTSTREAM_URING
+		/**
+		 * @brief Submits buffers with IORING_OP_WRITEV at explicit file offsets, so several buffers can be in flight without reordering. Uses the raw system calls, no liburing needed.
+		 * @details
+		 * 	Explicit offsets do not move the file offset, it is set to the end of the written data whenever all buffers are written (Wait()), so the fd can be used by others afterwards.
+		 * 	When the ring stops working (io_uring_enter keeps failing, writes keep being retried), Failed is set and the remaining data is written with pwrite.
+		 */
+		class UringBackend : public AsyncFileOutStream::Backend
+		{
+		private:
+			struct Request
+			{
+				iovec Vector;
+				off_t Offset;
+				unsigned int Retries;
+				bool Pending;
+			};
+
+			// Resubmits of a write that was interrupted or would block, and failed io_uring_enter calls in a row while waiting, before falling back to pwrite
+			static constexpr unsigned int MaxRetries = 16;
+
+			int Fd;
+			int RingFd = -1;
+			off_t Offset;
+			size_t BufferSize;
+			unsigned int InFlight = 0;
+			unsigned int Stalls = 0;
+			bool Broken = false;
+			std::vector<Request> Requests;
+
+			void* SqRing = MAP_FAILED;
+			void* CqRing = MAP_FAILED;
+			size_t SqRingSize = 0;
+			size_t CqRingSize = 0;
+			io_uring_sqe* Sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+			size_t SqesSize = 0;
+
+			unsigned int* SqTail;
+			unsigned int* SqMask;
+			unsigned int* SqArray;
+			unsigned int* CqHead;
+			unsigned int* CqTail;
+			unsigned int* CqMask;
+			io_uring_cqe* Cqes;
+
+			int Enter(unsigned int ToSubmit, unsigned int MinComplete, unsigned int Flags)
+			{
+				while (true)
+				{
+					int Result = syscall(__NR_io_uring_enter, RingFd, ToSubmit, MinComplete, Flags, nullptr, 0);
+					if (Result >= 0 || errno != EINTR)
+						return Result;
+				}
+			}
+
+			void Queue(size_t Index)
+			{
+				unsigned int Tail = *SqTail;
+				io_uring_sqe* Sqe = &Sqes[Tail & *SqMask];
+				memset(Sqe, 0, sizeof(io_uring_sqe));
+				Sqe->opcode = IORING_OP_WRITEV;
+				Sqe->fd = Fd;
+				Sqe->addr = reinterpret_cast<uintptr_t>(&Requests[Index].Vector);
+				Sqe->len = 1;
+				Sqe->off = Requests[Index].Offset;
+				Sqe->user_data = Index;
+				SqArray[Tail & *SqMask] = Tail & *SqMask;
+				__atomic_store_n(SqTail, Tail + 1, __ATOMIC_RELEASE);
+				if (Enter(1, 0, 0) < 0)
+				{
+					// Cannot submit, write synchronously instead
+					__atomic_store_n(SqTail, Tail, __ATOMIC_RELEASE);
+					WriteSynchronously(Requests[Index]);
+					Complete(Index);
+				}
+			}
+
+			void WriteSynchronously(Request& Job)
+			{
+				while (Job.Vector.iov_len)
+				{
+					ssize_t Written = pwrite(Fd, Job.Vector.iov_base, Job.Vector.iov_len, Job.Offset);
+					if (Written < 0 && errno == EINTR)
+						continue;
+					if (Written <= 0)
+					{
+						Failed.store(true, std::memory_order_relaxed);
+						return;
+					}
+					Job.Vector.iov_base = static_cast<char*>(Job.Vector.iov_base) + Written;
+					Job.Vector.iov_len -= Written;
+					Job.Offset += Written;
+				}
+			}
+
+			void Complete(size_t Index)
+			{
+				Requests[Index].Pending = false;
+				FreeBuffers.push_back(Buffers[Index]);
+				InFlight--;
+			}
+
+			void Reap()
+			{
+				// Completions after GiveUp() are ignored, their buffers stay retired
+				if (Broken)
+					return;
+				unsigned int Head = *CqHead;
+				while (Head != __atomic_load_n(CqTail, __ATOMIC_ACQUIRE))
+				{
+					io_uring_cqe& Cqe = Cqes[Head & *CqMask];
+					size_t Index = Cqe.user_data;
+					int Result = Cqe.res;
+					Head++;
+					__atomic_store_n(CqHead, Head, __ATOMIC_RELEASE);
+
+					Request& Done = Requests[Index];
+					if ((Result == -EINTR || Result == -EAGAIN) && Done.Retries++ < MaxRetries)
+						Queue(Index);
+					else if (Result == -EINTR || Result == -EAGAIN)
+					{
+						Failed.store(true, std::memory_order_relaxed);
+						WriteSynchronously(Done);
+						Complete(Index);
+					}
+					else if (Result <= 0)
+					{
+						Failed.store(true, std::memory_order_relaxed);
+						Complete(Index);
+					}
+					else if (static_cast<size_t>(Result) < Done.Vector.iov_len)
+					{
+						// Short write, submit the rest
+						Done.Vector.iov_base = static_cast<char*>(Done.Vector.iov_base) + Result;
+						Done.Vector.iov_len -= Result;
+						Done.Offset += Result;
+						Done.Retries = 0;
+						Queue(Index);
+					}
+					else
+						Complete(Index);
+				}
+			}
+
+			void WaitForOne()
+			{
+				if (Enter(0, 1, IORING_ENTER_GETEVENTS) >= 0)
+					Stalls = 0;
+				else if (++Stalls > MaxRetries)
+				{
+					GiveUp();
+					return;
+				}
+				else
+					std::this_thread::yield();
+				Reap();
+			}
+
+			/**
+			 * @brief Stops using the ring after io_uring_enter failed too often. Writes what is still in flight again with pwrite, the same bytes at the same offsets.
+			 * @details The kernel may still read the buffers of these writes, so they are never handed out again. From now on Submit() writes synchronously with the buffer the stream is filling.
+			 */
+			void GiveUp()
+			{
+				Failed.store(true, std::memory_order_relaxed);
+				Reap();
+				Broken = true;
+				for (Request& Job : Requests)
+				{
+					if (Job.Pending)
+						WriteSynchronously(Job);
+				}
+				InFlight = 0;
+			}
+
+		public:
+			UringBackend(int Fd, off_t Offset, size_t BufferSize, unsigned int MaxInFlight) : Backend(BufferSize, MaxInFlight), Fd(Fd), Offset(Offset), BufferSize(BufferSize), Requests(MaxInFlight + 1) {}
+
+			~UringBackend()
+			{
+				if (Sqes != MAP_FAILED)
+					munmap(Sqes, SqesSize);
+				if (CqRing != MAP_FAILED && CqRing != SqRing)
+					munmap(CqRing, CqRingSize);
+				if (SqRing != MAP_FAILED)
+					munmap(SqRing, SqRingSize);
+				if (RingFd >= 0)
+					::close(RingFd);
+			}
+
+			bool Setup(unsigned int Entries)
+			{
+				io_uring_params Params;
+				memset(&Params, 0, sizeof(Params));
+				RingFd = syscall(__NR_io_uring_setup, Entries, &Params);
+				if (RingFd < 0)
+					return false;
+
+				SqRingSize = Params.sq_off.array + Params.sq_entries * sizeof(unsigned int);
+				CqRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+				bool SingleMap = Params.features & IORING_FEAT_SINGLE_MMAP;
+				if (SingleMap && CqRingSize > SqRingSize)
+					SqRingSize = CqRingSize;
+				SqRing = mmap(nullptr, SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQ_RING);
+				if (SqRing == MAP_FAILED)
+					return false;
+				CqRing = SingleMap ? SqRing : mmap(nullptr, CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_CQ_RING);
+				if (CqRing == MAP_FAILED)
+					return false;
+				SqesSize = Params.sq_entries * sizeof(io_uring_sqe);
+				Sqes = static_cast<io_uring_sqe*>(mmap(nullptr, SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQES));
+				if (Sqes == MAP_FAILED)
+					return false;
+
+				char* Sq = static_cast<char*>(SqRing);
+				char* Cq = static_cast<char*>(CqRing);
+				SqTail = reinterpret_cast<unsigned int*>(Sq + Params.sq_off.tail);
+				SqMask = reinterpret_cast<unsigned int*>(Sq + Params.sq_off.ring_mask);
+				SqArray = reinterpret_cast<unsigned int*>(Sq + Params.sq_off.array);
+				CqHead = reinterpret_cast<unsigned int*>(Cq + Params.cq_off.head);
+				CqTail = reinterpret_cast<unsigned int*>(Cq + Params.cq_off.tail);
+				CqMask = reinterpret_cast<unsigned int*>(Cq + Params.cq_off.ring_mask);
+				Cqes = reinterpret_cast<io_uring_cqe*>(Cq + Params.cq_off.cqes);
+				return true;
+			}
+
+			virtual bool IsUring() const override { return true; }
+
+			virtual char* Submit(char* Buffer, size_t Length) override
+			{
+				Reap();
+				while (!Broken && InFlight >= MaxInFlight)
+					WaitForOne();
+
+				if (Broken)
+				{
+					Request Job = { { Buffer, Length }, Offset, 0, false };
+					Offset += Length;
+					WriteSynchronously(Job);
+					return Buffer;
+				}
+
+				size_t Index = 0;
+				while (Buffers[Index] != Buffer)
+					Index++;
+				Requests[Index].Vector.iov_base = Buffer;
+				Requests[Index].Vector.iov_len = Length;
+				Requests[Index].Offset = Offset;
+				Requests[Index].Retries = 0;
+				Requests[Index].Pending = true;
+				Offset += Length;
+				InFlight++;
+				Queue(Index);
+
+				Reap();
+				while (!Broken && FreeBuffers.empty())
+					WaitForOne();
+				if (FreeBuffers.empty())
+				{
+					// All buffers were retired by GiveUp()
+					Buffers.push_back(new char[BufferSize]);
+					return Buffers.back();
+				}
+				char* Free = FreeBuffers.back();
+				FreeBuffers.pop_back();
+				return Free;
+			}
+
+			virtual void Wait() override
+			{
+				Reap();
+				while (InFlight)
+					WaitForOne();
+				lseek(Fd, Offset, SEEK_SET);
+			}
+		};
+#endif
+
+	}
+
+	AsyncFileOutStream::AsyncFileOutStream(int Fd, size_t BufferSize, unsigned int MaxInFlight) : Fd(Fd), OwnsFd(false), BufferSize(BufferSize)
+	{
+		Init(MaxInFlight);
+	}
+
+	AsyncFileOutStream::AsyncFileOutStream(const char* Path, size_t BufferSize, unsigned int MaxInFlight) : Fd(::open(Path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)), OwnsFd(true), BufferSize(BufferSize)
+	{
+		Init(MaxInFlight);
+		if (Fd < 0)
+			Engine->Failed.store(true, std::memory_order_relaxed);
+	}
+
+	AsyncFileOutStream::~AsyncFileOutStream()
+	{
+		Flush();
+		delete Engine;
+		if (OwnsFd && Fd >= 0)
+			::close(Fd);
+	}
+
+	void AsyncFileOutStream::Init(unsigned int MaxInFlight)
+	{
+		if (!MaxInFlight)
+			MaxInFlight = 1;
+		Engine = nullptr;
+#ifdef INO_ASYNCFILEOUTSTREAM_URING
+		// Explicit offsets need a seekable file
+		off_t Offset = Fd >= 0 ? lseek(Fd, 0, SEEK_CUR) : -1;
+		if (Offset >= 0 && !(fcntl(Fd, F_GETFL) & O_APPEND))
+		{
+			UringBackend* Uring = new UringBackend(Fd, Offset, BufferSize, MaxInFlight);
+			if (Uring->Setup(MaxInFlight + 1))
+				Engine = Uring;
+			else
+				delete Uring;
+		}
+#endif
+		if (!Engine)
+			Engine = new ThreadBackend(Fd, BufferSize, MaxInFlight);
+		Current = Engine->TakeFirst();
+	}
+
+	bool AsyncFileOutStream::UsesIoUring() const
+	{
+		return Engine->IsUring();
+	}
+
+	bool AsyncFileOutStream::Failed() const
+	{
+		return Engine->Failed.load(std::memory_order_relaxed);
+	}
+
+	void AsyncFileOutStream::Write(char Character)
+	{
+		Current[Length++] = Character;
+		if (Length == BufferSize)
+			Submit();
+	}
+
+	void AsyncFileOutStream::WriteBlock(const char* Data, unsigned int BlockLength)
+	{
+		while (BlockLength)
+		{
+			size_t Chunk = BufferSize - Length;
+			if (Chunk > BlockLength)
+				Chunk = BlockLength;
+			memcpy(Current + Length, Data, Chunk);
+			Length += Chunk;
+			Data += Chunk;
+			BlockLength -= Chunk;
+			if (Length == BufferSize)
+				Submit();
+		}
+	}
+
+	void AsyncFileOutStream::Submit()
+	{
+		if (!Length)
+			return;
+		Current = Engine->Submit(Current, Length);
+		Length = 0;
+	}
+
+	bool AsyncFileOutStream::Flush()
+	{
+		Submit();
+		Engine->Wait();
+		return !Failed();
+	}
+
+}
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+#ifndef INO_ASYNCFILEOUTSTREAM_INCLUDED
+#define INO_ASYNCFILEOUTSTREAM_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "OutStream.h"
+
+#ifndef INO_ASYNCFILEOUTSTREAM_BUFFERSIZE
+#define INO_ASYNCFILEOUTSTREAM_BUFFERSIZE 65536
+#endif
+
+#ifndef INO_ASYNCFILEOUTSTREAM_INFLIGHT
+#define INO_ASYNCFILEOUTSTREAM_INFLIGHT 4
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Output stream to a file that never waits for the disk while formatting (host only).
+	 * @details
+	 * 	Output is collected in a buffer. Full buffers are submitted asynchronously and formatting continues in the next free buffer, at most `MaxInFlight` buffers are being written at a time.
+	 * 	On Linux buffers are submitted through io_uring. Where io_uring is not available (old kernels, seccomp filters) or the file is not seekable (pipes, sockets), a writer thread is used instead.
+	 * 	Formatting only waits when all `MaxInFlight` buffers are still in flight, which means the disk cannot keep up with the data rate.
+	 */
+	class AsyncFileOutStream : public OutStream
+	{
+	public:
+		class Backend;
+
+	private:
+		int Fd;
+		bool OwnsFd;
+		size_t BufferSize;
+		Backend* Engine;
+		char* Current;
+		size_t Length = 0;
+
+	protected:
+		virtual void Write(char Character) override;
+		virtual void WriteBlock(const char* Data, unsigned int BlockLength) override;
+
+	public:
+		AsyncFileOutStream(int Fd, size_t BufferSize = INO_ASYNCFILEOUTSTREAM_BUFFERSIZE, unsigned int MaxInFlight = INO_ASYNCFILEOUTSTREAM_INFLIGHT);
+		AsyncFileOutStream(const char* Path, size_t BufferSize = INO_ASYNCFILEOUTSTREAM_BUFFERSIZE, unsigned int MaxInFlight = INO_ASYNCFILEOUTSTREAM_INFLIGHT);
+		~AsyncFileOutStream();
+
+		AsyncFileOutStream(const AsyncFileOutStream&) = delete;
+		AsyncFileOutStream& operator=(const AsyncFileOutStream&) = delete;
+
+		inline int GetFd() const { return Fd; }
+		bool UsesIoUring() const;
+		bool Failed() const;
+
+		/**
+		 * @brief Submits the current buffer without waiting for it.
+		 */
+		void Submit();
+
+		/**
+		 * @brief Submits the current buffer and waits until everything is written.
+		 * @return Returns false, if any write failed.
+		 */
+		bool Flush();
+
+	private:
+		void Init(unsigned int MaxInFlight);
+
+	};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+#include "InoCore.h"
+#include "Clock.h"
+
+#ifdef INO_HOST
+#include <chrono>
+#endif
+
+namespace ino {
+
+	unsigned long (*Clock::MicrosSource)() = nullptr;
+	unsigned long (*Clock::MillisSource)() = nullptr;
+
+	unsigned long Clock::Micros()
+	{
+		if (MicrosSource)
+			return MicrosSource();
+#ifdef INO_HOST
+		return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+		return micros();
+#endif
+	}
+
+	unsigned long Clock::Millis()
+	{
+		if (MillisSource)
+			return MillisSource();
+#ifdef INO_HOST
+		return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+		return millis();
+#endif
+	}
+
+	void Clock::Set(unsigned long (*Micros)(), unsigned long (*Millis)())
+	{
+		MicrosSource = Micros;
+		MillisSource = Millis;
+	}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef INO_CLOCK_INCLUDED
+#define INO_CLOCK_INCLUDED
+
+#include "InoCore.h"
+
+#include <Arduino.h>
+
+namespace ino {
+
+	/**
+	 * @brief Time source of the library, everything in it that measures or waits for time uses it.
+	 * @details
+	 * 	By default `micros()` and `millis()`, on host `std::chrono::steady_clock`.
+	 * 	A simulation replaces it with its own time (see ino::VirtualClock::Install), then all of the library runs on simulated time and no stream sleeps for real time.
+	 */
+	class Clock
+	{
+	private:
+		static unsigned long (*MicrosSource)();
+		static unsigned long (*MillisSource)();
+
+	public:
+		static unsigned long Micros();
+		static unsigned long Millis();
+
+		// Replaces the time source, `nullptr` for both restores the default
+		static void Set(unsigned long (*Micros)(), unsigned long (*Millis)());
+		static inline bool IsReplaced() { return MicrosSource != nullptr; }
+	};
+
+}
+
+#endif
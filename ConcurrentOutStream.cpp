@@ -0,0 +1,323 @@
+#include "InoCore.h"
+#include "ConcurrentOutStream.h"
+
+#ifdef INO_HOST
+
+#include <chrono>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace ino {
+
+	static_assert(INO_CONCURRENTOUTSTREAM_RECORDSIZE <= INO_CONCURRENTOUTSTREAM_CELLS * INO_CONCURRENTOUTSTREAM_CELLSIZE, "INO_CONCURRENTOUTSTREAM_RECORDSIZE does not fit into the queue");
+
+	namespace {
+
+		void WriteAll(int Fd, const char* Data, size_t Length)
+		{
+			while (Length)
+			{
+				ssize_t Written = ::write(Fd, Data, Length);
+				if (Written < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					return;
+				}
+				Data += Written;
+				Length -= Written;
+			}
+		}
+
+	}
+
+	/**
+	 * @brief Part of a stream that outlives it as long as records of some thread refer to it. Other threads commit to the stream only between Enter() and Leave(), the destructor of the stream waits for them.
+	 */
+	struct ConcurrentOutStream::Handle
+	{
+		ConcurrentOutStream* Stream;
+		std::atomic<unsigned int> References{1}; // The stream and every record that refers to it
+		std::atomic<unsigned int> Committing{0};
+		std::atomic<bool> Alive{true};
+
+		explicit Handle(ConcurrentOutStream* Stream) : Stream(Stream) {}
+
+		// Returns true if the stream is alive, then it stays alive until Leave()
+		bool Enter()
+		{
+			Committing.fetch_add(1);
+			if (Alive.load())
+				return true;
+			Committing.fetch_sub(1);
+			return false;
+		}
+
+		void Leave() { Committing.fetch_sub(1, std::memory_order_release); }
+		void Acquire() { References.fetch_add(1, std::memory_order_relaxed); }
+		void Release()
+		{
+			if (References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
+		}
+	};
+
+	/**
+	 * @brief Records of one thread, each collects the output of the thread to one stream. A small map from the stream to its record without any locking, only the owning thread accesses it.
+	 * @details Unfinished records are committed when the thread exits.
+	 */
+	struct ConcurrentOutStream::ThreadRecords
+	{
+		struct Record
+		{
+			Handle* Owner = nullptr;
+			size_t Length = 0;
+			char* Data = nullptr; // Allocated on first use, keeps the thread-local storage small
+		};
+
+		Record Slots[INO_CONCURRENTOUTSTREAM_THREADRECORDS];
+		unsigned int Last = 0; // Record used last, checked first
+		unsigned int Victim = 0; // Next record to commit early when all are in use
+
+		~ThreadRecords()
+		{
+			for (Record& Slot : Slots)
+			{
+				Vacate(Slot);
+				delete[] Slot.Data;
+			}
+		}
+
+		Record* Find(Handle* Owner)
+		{
+			if (Slots[Last].Owner == Owner)
+				return &Slots[Last];
+			for (unsigned int S = 0; S < INO_CONCURRENTOUTSTREAM_THREADRECORDS; S++)
+			{
+				if (Slots[S].Owner == Owner)
+				{
+					Last = S;
+					return &Slots[S];
+				}
+			}
+			return nullptr;
+		}
+
+		/**
+		 * @brief Record of the stream, takes an empty record or one of a destroyed stream if there is none yet. When all records hold unfinished output for other streams, one of them is committed early.
+		 */
+		Record& For(Handle* Owner)
+		{
+			Record* Found = Find(Owner);
+			if (Found)
+				return *Found;
+
+			unsigned int Free = 0;
+			while (Free < INO_CONCURRENTOUTSTREAM_THREADRECORDS && Slots[Free].Owner && Slots[Free].Length && Slots[Free].Owner->Alive.load(std::memory_order_relaxed))
+				Free++;
+			if (Free == INO_CONCURRENTOUTSTREAM_THREADRECORDS)
+			{
+				Free = Victim;
+				Victim = (Victim + 1) % INO_CONCURRENTOUTSTREAM_THREADRECORDS;
+			}
+
+			Record& Slot = Slots[Free];
+			Vacate(Slot);
+			if (!Slot.Data)
+				Slot.Data = new char[INO_CONCURRENTOUTSTREAM_RECORDSIZE];
+			Slot.Owner = Owner;
+			Owner->Acquire();
+			Last = Free;
+			return Slot;
+		}
+
+		/**
+		 * @brief Commits the record to its stream, or drops it if the stream was destroyed, and releases the stream.
+		 */
+		static void Vacate(Record& Slot)
+		{
+			if (!Slot.Owner)
+				return;
+			if (Slot.Length && Slot.Owner->Enter())
+			{
+				Slot.Owner->Stream->Enqueue(Slot.Data, Slot.Length);
+				Slot.Owner->Leave();
+			}
+			Slot.Owner->Release();
+			Slot.Owner = nullptr;
+			Slot.Length = 0;
+		}
+	};
+
+	thread_local ConcurrentOutStream::ThreadRecords ConcurrentOutStream::Records;
+
+	ConcurrentOutStream::ConcurrentOutStream(int Fd) : Fd(Fd), Self(new Handle(this)), Cells(new Cell[INO_CONCURRENTOUTSTREAM_CELLS])
+	{
+		for (size_t C = 0; C < INO_CONCURRENTOUTSTREAM_CELLS; C++)
+			Cells[C].Sequence.store(C, std::memory_order_relaxed);
+		Writer = std::thread(&ConcurrentOutStream::Drain, this);
+	}
+
+	/**
+	 * @brief Commits the record of the calling thread and writes everything that is queued.
+	 * @details Unfinished records (no line break yet) of other threads cannot be reached, those threads drop them. So all producers should be done before.
+	 */
+	ConcurrentOutStream::~ConcurrentOutStream()
+	{
+		Commit();
+		Self->Alive.store(false);
+		while (Self->Committing.load()) // Threads that are committing a record to this stream
+			std::this_thread::yield();
+		Running.store(false, std::memory_order_release);
+		Writer.join();
+		delete[] Cells;
+		Self->Release();
+	}
+
+	void ConcurrentOutStream::Write(char Character)
+	{
+		ThreadRecords::Record& Record = Records.For(Self);
+		Record.Data[Record.Length++] = Character;
+		if (Character != '\n' && Record.Length == INO_CONCURRENTOUTSTREAM_RECORDSIZE)
+			Split.store(true, std::memory_order_relaxed);
+		else if (Character != '\n')
+			return;
+		Enqueue(Record.Data, Record.Length);
+		Record.Length = 0;
+	}
+
+	void ConcurrentOutStream::WriteBlock(const char* Data, unsigned int Length)
+	{
+		ThreadRecords::Record& Record = Records.For(Self);
+		while (Length)
+		{
+			size_t Chunk = INO_CONCURRENTOUTSTREAM_RECORDSIZE - Record.Length;
+			if (Chunk > Length)
+				Chunk = Length;
+			memcpy(Record.Data + Record.Length, Data, Chunk);
+			Record.Length += Chunk;
+			Data += Chunk;
+			Length -= Chunk;
+
+			// Commit complete lines, keep the unfinished one
+			const char* LastLine = static_cast<const char*>(memrchr(Record.Data + Record.Length - Chunk, '\n', Chunk));
+			if (LastLine)
+			{
+				size_t Complete = LastLine - Record.Data + 1;
+				Enqueue(Record.Data, Complete);
+				Record.Length -= Complete;
+				memmove(Record.Data, Record.Data + Complete, Record.Length);
+			}
+			else if (Record.Length == INO_CONCURRENTOUTSTREAM_RECORDSIZE)
+			{
+				Split.store(true, std::memory_order_relaxed);
+				Enqueue(Record.Data, Record.Length);
+				Record.Length = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief Queues the record of the calling thread, even if it does not end with a line break.
+	 */
+	void ConcurrentOutStream::Commit()
+	{
+		ThreadRecords::Record* Record = Records.Find(Self);
+		if (Record && Record->Length)
+		{
+			Enqueue(Record->Data, Record->Length);
+			Record->Length = 0;
+		}
+	}
+
+	/**
+	 * @brief Commits the record of the calling thread and waits until everything queued so far has been written.
+	 */
+	void ConcurrentOutStream::Flush()
+	{
+		Commit();
+		size_t Target = EnqueuePos.load(std::memory_order_acquire);
+		while (WrittenPos.load(std::memory_order_acquire) < Target)
+			std::this_thread::yield();
+	}
+
+	/**
+	 * @brief Claims enough consecutive cells for the record with a single compare-and-swap, copies the record and publishes the cells.
+	 */
+	void ConcurrentOutStream::Enqueue(const char* Data, size_t Length)
+	{
+		size_t Count = (Length + INO_CONCURRENTOUTSTREAM_CELLSIZE - 1) / INO_CONCURRENTOUTSTREAM_CELLSIZE;
+		size_t Pos = EnqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			bool Free = true;
+			for (size_t C = 0; C < Count; C++)
+			{
+				intptr_t Difference = static_cast<intptr_t>(Cells[(Pos + C) & Mask].Sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(Pos + C);
+				if (Difference != 0)
+				{
+					Free = false;
+					if (Difference < 0) // Queue full
+						std::this_thread::yield();
+					Pos = EnqueuePos.load(std::memory_order_relaxed);
+					break;
+				}
+			}
+			if (Free && EnqueuePos.compare_exchange_weak(Pos, Pos + Count, std::memory_order_relaxed))
+				break;
+		}
+
+		for (size_t C = 0; C < Count; C++)
+		{
+			Cell& Target = Cells[(Pos + C) & Mask];
+			Target.Length = Length < INO_CONCURRENTOUTSTREAM_CELLSIZE ? Length : INO_CONCURRENTOUTSTREAM_CELLSIZE;
+			memcpy(Target.Data, Data, Target.Length);
+			Data += Target.Length;
+			Length -= Target.Length;
+			Target.Sequence.store(Pos + C + 1, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * @brief Writer thread. Collects published cells in order into a batch and writes it with a single call, sleeps shortly when the queue is empty.
+	 */
+	void ConcurrentOutStream::Drain()
+	{
+		static constexpr size_t BatchSize = 64 * 1024;
+		char* Batch = new char[BatchSize];
+		while (true)
+		{
+			size_t Length = DrainReady(Batch, BatchSize);
+			if (Length)
+			{
+				WriteAll(Fd, Batch, Length);
+				WrittenPos.store(ReadPos, std::memory_order_release);
+			}
+			else if (!Running.load(std::memory_order_acquire) && ReadPos == EnqueuePos.load(std::memory_order_acquire))
+				break;
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+		delete[] Batch;
+	}
+
+	size_t ConcurrentOutStream::DrainReady(char* Batch, size_t Size)
+	{
+		size_t Length = 0;
+		while (true)
+		{
+			Cell& Source = Cells[ReadPos & Mask];
+			if (Source.Sequence.load(std::memory_order_acquire) != ReadPos + 1 || Length + Source.Length > Size)
+				break;
+			memcpy(Batch + Length, Source.Data, Source.Length);
+			Length += Source.Length;
+			Source.Sequence.store(ReadPos + INO_CONCURRENTOUTSTREAM_CELLS, std::memory_order_release);
+			ReadPos++;
+		}
+		return Length;
+	}
+
+}
+
+#endif
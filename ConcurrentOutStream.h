@@ -0,0 +1,98 @@
+#pragma once
+#ifndef INO_CONCURRENTOUTSTREAM_INCLUDED
+#define INO_CONCURRENTOUTSTREAM_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "OutStream.h"
+
+#include <atomic>
+#include <thread>
+
+#ifndef INO_CONCURRENTOUTSTREAM_CELLS
+#define INO_CONCURRENTOUTSTREAM_CELLS 1024
+#endif
+
+#ifndef INO_CONCURRENTOUTSTREAM_CELLSIZE
+#define INO_CONCURRENTOUTSTREAM_CELLSIZE 120
+#endif
+
+#ifndef INO_CONCURRENTOUTSTREAM_RECORDSIZE
+#define INO_CONCURRENTOUTSTREAM_RECORDSIZE 4096
+#endif
+
+#ifndef INO_CONCURRENTOUTSTREAM_THREADRECORDS
+#define INO_CONCURRENTOUTSTREAM_THREADRECORDS 4
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Output stream to a file descriptor that can be shared by several threads (host only).
+	 * @details
+	 * 	Every thread collects its output in a thread-local record until a line break, then the record is copied into consecutive cells of a bounded lock-free queue.
+	 * 	A writer thread drains the queue in order and passes the records to `write()` in large batches, so records of different threads never interleave.
+	 * 	Producers never take a mutex, when the queue is full they yield until the writer catches up.
+	 * 	Every thread has `INO_CONCURRENTOUTSTREAM_THREADRECORDS` records, one per stream it writes to. When it writes to more streams at a time, the unfinished record of one of them is committed early.
+	 * 	Records longer than `INO_CONCURRENTOUTSTREAM_RECORDSIZE` are committed in parts, which may interleave with other threads, this is remembered by Overflowed().
+	 * 	Records are tied to a handle of the stream that outlives it, so a record of a destroyed stream is dropped instead of being committed to it or to a new stream at the same address.
+	 */
+	class ConcurrentOutStream : public OutStream
+	{
+	private:
+		struct Handle;
+		struct ThreadRecords;
+
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			uint16_t Length;
+			char Data[INO_CONCURRENTOUTSTREAM_CELLSIZE];
+		};
+
+		static thread_local ThreadRecords Records; // Records of the calling thread
+
+		static constexpr size_t Mask = INO_CONCURRENTOUTSTREAM_CELLS - 1;
+		static_assert((INO_CONCURRENTOUTSTREAM_CELLS & Mask) == 0, "INO_CONCURRENTOUTSTREAM_CELLS must be a power of two");
+
+		int Fd;
+		Handle* Self; // Owner of the thread-local records
+		Cell* Cells;
+		std::atomic<size_t> EnqueuePos{0};
+		std::atomic<size_t> WrittenPos{0};
+		size_t ReadPos = 0; // Only used by the writer thread
+		std::atomic<bool> Running{true};
+		std::atomic<bool> Split{false};
+		std::thread Writer;
+
+	protected:
+		virtual void Write(char Character) override;
+		virtual void WriteBlock(const char* Data, unsigned int Length) override;
+
+	public:
+		ConcurrentOutStream(int Fd = 1);
+		~ConcurrentOutStream();
+
+		ConcurrentOutStream(const ConcurrentOutStream&) = delete;
+		ConcurrentOutStream& operator=(const ConcurrentOutStream&) = delete;
+
+		void Commit();
+		void Flush();
+
+		// Whether a record longer than `INO_CONCURRENTOUTSTREAM_RECORDSIZE` was committed in parts
+		inline bool Overflowed() const { return Split.load(std::memory_order_relaxed); }
+
+	private:
+		void Enqueue(const char* Data, size_t Length);
+		void Drain();
+		size_t DrainReady(char* Batch, size_t Size);
+
+	};
+
+}
+
+#endif
+
+#endif
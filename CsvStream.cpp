@@ -0,0 +1,183 @@
+#include "InoCore.h"
+#include "CsvStream.h"
+
+namespace ino {
+
+	// * ----- CsvWriter ----------------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Ends the current row with ino::endl and writes the collected row to the stream.
+	 */
+	CsvWriter& CsvWriter::EndRow()
+	{
+		Row.Put(endl);
+		if (Row.Overflowed())
+		{
+			Flush(Row.GetLength());
+			Row.Put(endl);
+		}
+		Flush(Row.GetLength());
+		FirstField = true;
+		return *this;
+	}
+
+	/**
+	 * @brief Writes the separator if needed.
+	 * @return Returns the position where the field starts in the row buffer.
+	 */
+	size_t CsvWriter::BeginField()
+	{
+		if (!FirstField)
+		{
+			Row.Put(Separator);
+			if (Row.Overflowed())
+			{
+				Flush(Row.GetLength());
+				Row.Put(Separator);
+			}
+		}
+		FirstField = false;
+		return Row.GetLength();
+	}
+
+	/**
+	 * @brief Quotes the field starting at `Start` in place, if it contains the separator, a quote or a line break.
+	 * @return Returns `false` if the quoted field does not fit into the row buffer.
+	 */
+	bool CsvWriter::FinishField(size_t Start)
+	{
+		char* Data = Row.GetSpan();
+		size_t End = Row.GetLength();
+		size_t Quotes = 0;
+		bool NeedsQuotes = false;
+		for (size_t C = Start; C < End; C++)
+		{
+			if (Data[C] == '"')
+				Quotes++;
+			if (Data[C] == Separator || Data[C] == '"' || Data[C] == '\n' || Data[C] == '\r')
+				NeedsQuotes = true;
+		}
+		if (!NeedsQuotes)
+			return true;
+
+		size_t Extra = Quotes + 2;
+		if (Extra > Row.SpanSize() - End)
+			return false;
+		for (size_t C = 0; C < Extra; C++)
+			Row.Put('"');
+
+		// Shift backwards, doubling quotes on the way
+		size_t Target = End + Extra - 1;
+		Data[Target--] = '"';
+		for (size_t C = End; C > Start; C--)
+		{
+			Data[Target--] = Data[C - 1];
+			if (Data[C - 1] == '"')
+				Data[Target--] = '"';
+		}
+		Data[Target] = '"';
+		return true;
+	}
+
+	void CsvWriter::Flush(size_t Length)
+	{
+		if (Length)
+			Stream.Put(Row.GetSpan(), Length);
+		Row.Clear();
+	}
+
+
+	// * ----- CsvReader ----------------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Reads the next field of the current row into a c-string of `Size` characters (including the terminating `'\0'`).
+	 * @return Returns `false` if there is no field left in the row, the stream has no data or the field does not fit (the fail flag ino::InStream::Fails::WrongCString is set, the field is truncated).
+	 */
+	bool CsvReader::ReadField(char* Buffer, size_t Size)
+	{
+		size_t Length;
+		if (Size == 0)
+			return false;
+		bool Success = ScanField(Buffer, Size, Length);
+		Buffer[Length] = '\0';
+		return Success;
+	}
+
+	/**
+	 * @brief Skips the remaining fields of the current row.
+	 */
+	void CsvReader::NextRow()
+	{
+		size_t Length;
+		while (!RowEnd && ScanField(nullptr, 0, Length));
+		RowEnd = false;
+	}
+
+	/**
+	 * @brief Collects the next field of the current row, without quotes, in `Buffer`. The characters are not terminated.
+	 * @details If `Size` is `0`, the field is skipped. Fields that do not fit into `Size - 1` characters set the fail flag ino::InStream::Fails::WrongCString.
+	 */
+	bool CsvReader::ScanField(char* Buffer, size_t Size, size_t& Length)
+	{
+		Length = 0;
+		if (RowEnd)
+		{
+			SetFailFlag(Fails::WrongFormat);
+			return false;
+		}
+		if (!Stream.WaitForData())
+		{
+			SetFailFlag(Fails::NoData);
+			return false;
+		}
+
+		bool Quoted = Stream.Peek() == '"';
+		if (Quoted)
+			Stream.Read();
+
+		bool Fits = true;
+		while (true)
+		{
+			if (!Stream.WaitForData())
+			{
+				if (Quoted)
+					SetFailFlag(Fails::WrongFormat);
+				RowEnd = true;
+				break;
+			}
+
+			char Character = Stream.Read();
+			if (Quoted)
+			{
+				if (Character == '"')
+				{
+					if (!Stream.WaitForData() || Stream.Peek() != '"')
+					{
+						Quoted = false;
+						continue;
+					}
+					Stream.Read();
+				}
+			}
+			else if (Character == Separator)
+				break;
+			else if (Character == '\n')
+			{
+				RowEnd = true;
+				break;
+			}
+			else if (Character == '\r')
+				continue;
+
+			if (Length + 1 < Size)
+				Buffer[Length++] = Character;
+			else if (Size)
+				Fits = false;
+		}
+
+		if (!Fits)
+			SetFailFlag(Fails::WrongCString);
+		return Fits;
+	}
+
+}
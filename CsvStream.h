@@ -0,0 +1,181 @@
+#pragma once
+#ifndef INO_CSVSTREAM_INCLUDED
+#define INO_CSVSTREAM_INCLUDED
+
+#include "InoCore.h"
+#include "OutStream.h"
+#include "InStream.h"
+#include "SpanOutStream.h"
+#include "SpanInStream.h"
+
+#ifndef INO_CSV_ROWSIZE
+#define INO_CSV_ROWSIZE 64
+#endif
+
+#ifndef INO_CSV_FIELDSIZE
+#define INO_CSV_FIELDSIZE 32
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Writes CSV rows to an ino::OutStream.
+	 * @details
+	 * 	Fields are formatted with the output operators of ino::OutStream, so every format of StreamFormat.h can be used per column (ex. `Csv << ino::Hex(Id) << ino::Precision(Value, 2)`).
+	 * 	A row is collected in a buffer of `INO_CSV_ROWSIZE` characters and written with a single call to ino::OutStream::Put() by EndRow(). Longer rows are written in several blocks.
+	 * 	A single field that does not fit into the buffer is written directly to the stream character by character, it is always quoted then.
+	 * 	Fields containing the separator, a quote or a line break are quoted (ex. ino::DecimalComma with separator `,`).
+	 */
+	class CsvWriter
+	{
+	private:
+		class QuotedOutStream : public OutStream
+		{
+		private:
+			OutStream& Target;
+
+		protected:
+			virtual inline void Write(char Character) override { if (Character == '"') Target.Put('"'); Target.Put(Character); }
+
+		public:
+			QuotedOutStream(OutStream& Target) : Target(Target) {}
+		};
+
+		OutStream& Stream;
+		char Separator;
+		bool FirstField = true;
+		char Buffer[INO_CSV_ROWSIZE];
+		SpanOutStream Row;
+
+	public:
+		CsvWriter(OutStream& Stream, char Separator = ',') : Stream(Stream), Separator(Separator), Row(Buffer, INO_CSV_ROWSIZE) {}
+
+		inline char GetSeparator() const { return Separator; }
+
+		template <typename T>
+		CsvWriter& operator<<(const T& Field)
+		{
+			size_t Start = BeginField();
+			Row << Field;
+			if (Row.Overflowed() || !FinishField(Start))
+			{
+				Flush(Start);
+				Row << Field;
+				if (Row.Overflowed() || !FinishField(0))
+				{
+					// The field alone does not fit, so it cannot be checked for characters that need quotes, quote it anyway
+					Row.Clear();
+					QuotedOutStream Quoted(Stream);
+					Stream.Put('"');
+					Quoted << Field;
+					Stream.Put('"');
+				}
+			}
+			return *this;
+		}
+
+		CsvWriter& EndRow();
+
+		template <typename... Ts>
+		CsvWriter& WriteRow(const Ts&... Fields)
+		{
+			int Unpack[] = { 0, ((*this << Fields), 0)... };
+			(void)Unpack;
+			return EndRow();
+		}
+
+	private:
+		size_t BeginField();
+		bool FinishField(size_t Start);
+		void Flush(size_t Length);
+
+	};
+
+	/**
+	 * @brief Reads CSV rows from an ino::InStream field by field.
+	 * @details
+	 * 	Each field is collected in a buffer of `INO_CSV_FIELDSIZE` characters on the stack and parsed with the input operators of ino::InStream, so formats of StreamFormat.h can be used per column (ex. `Csv >> ino::Hex(Id)`).
+	 * 	Quoted fields may contain the separator, line breaks and doubled quotes. Rows end with `\n`, a preceding `\r` is ignored.
+	 * 	An empty field (ex. `1,,3` or `""`) is not a parse error: Strings and c-strings are set to empty (an exact c-string format fails with ino::InStream::Fails::WrongCString), other values are left unchanged. EmptyField() tells whether the last field was empty.
+	 * 	Reading past the last field of a row sets ino::InStream::Fails::WrongFormat, call NextRow() to continue with the next row.
+	 */
+	class CsvReader
+	{
+	public:
+		using Fails = InStream::Fails;
+
+	private:
+		InStream& Stream;
+		char Separator;
+		bool RowEnd = false;
+		bool Empty = false;
+		Fails FailFlags = Fails::NoFail;
+
+		inline void SetFailFlag(Fails Flag) { FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) | static_cast<typename std::underlying_type<Fails>::type>(Flag)); }
+
+	public:
+		CsvReader(InStream& Stream, char Separator = ',') : Stream(Stream), Separator(Separator) {}
+
+		inline bool Failed() const { return FailFlags != Fails::NoFail; }
+		inline bool Failed(Fails TestFlag) const { return static_cast<typename std::underlying_type<Fails>::type>(FailFlags) & static_cast<typename std::underlying_type<Fails>::type>(TestFlag); }
+		inline void ClearFails() { FailFlags = Fails::NoFail; }
+
+		inline char GetSeparator() const { return Separator; }
+		inline bool AtRowEnd() const { return RowEnd; }
+		inline bool EmptyField() const { return Empty; }
+
+		template <typename T>
+		CsvReader& operator>>(T&& Data)
+		{
+			char Field[INO_CSV_FIELDSIZE];
+			size_t Length;
+			bool Scanned = ScanField(Field, INO_CSV_FIELDSIZE, Length);
+			Empty = Scanned && Length == 0;
+			if (Empty)
+				SetEmpty(std::forward<T>(Data));
+			else if (Scanned)
+			{
+				SpanInStream Span(Field, Length);
+				Span >> std::forward<T>(Data);
+				if (Span.Failed())
+					SetFailFlag(Span.GetFails());
+			}
+			return *this;
+		}
+
+		bool ReadField(char* Buffer, size_t Size);
+		void NextRow();
+
+		/**
+		 * @brief Reads all fields of a row into `Fields` and moves on to the next row. Fields that are not read are skipped.
+		 * @return Returns `false` if any of the fields failed.
+		 */
+		template <typename... Ts>
+		bool ReadRow(Ts&&... Fields)
+		{
+			int Unpack[] = { 0, ((*this >> std::forward<Ts>(Fields)), 0)... };
+			(void)Unpack;
+			NextRow();
+			return !Failed();
+		}
+
+	private:
+		bool ScanField(char* Buffer, size_t Size, size_t& Length);
+
+		// Value of an empty field, only strings have one
+		inline void SetEmpty(String& Data) { Data = ""; }
+		template <typename T, typename... FmtTs, typename std::enable_if<MultiFormat<T, FmtTs...>::template Contains<CStringFormats>::value, int>::type = 0>
+		inline void SetEmpty(const MultiFormat<T, FmtTs...>& Data)
+		{
+			if (Data.template Get<CStringFormats>().StringMode == CStringFormats::Mode::Exact && Data.template Get<CStringFormats>().StringSize)
+				SetFailFlag(Fails::WrongCString);
+			Data.Var[0] = '\0';
+		}
+		template <typename T>
+		inline void SetEmpty(const T&) {}
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,192 @@
+#include "InoCore.h"
+#include "FdStream.h"
+
+#ifdef INO_HOST
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace ino {
+
+	namespace {
+
+		bool WriteVector(int Fd, iovec* Vector, int Count)
+		{
+			while (Count)
+			{
+				ssize_t Written = ::writev(Fd, Vector, Count);
+				if (Written < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					return false;
+				}
+				while (Count && static_cast<size_t>(Written) >= Vector->iov_len)
+				{
+					Written -= Vector->iov_len;
+					Vector++;
+					Count--;
+				}
+				if (Count)
+				{
+					Vector->iov_base = static_cast<char*>(Vector->iov_base) + Written;
+					Vector->iov_len -= Written;
+				}
+			}
+			return true;
+		}
+
+	}
+
+	// * ----- FdOutStream --------------------------------------------------------------------------------------------------------
+
+	FdOutStream::FdOutStream(int Fd) : Fd(Fd), LineBuffered(isatty(Fd)) {}
+
+	FdOutStream::~FdOutStream()
+	{
+		Flush();
+	}
+
+	void FdOutStream::Write(char Character)
+	{
+		Buffer[Length++] = Character;
+#ifdef INO_STREAMSTATS
+		AddOccupancy(Length);
+#endif
+		if (Length == INO_FDSTREAM_BUFFERSIZE || (LineBuffered && Character == '\n'))
+			Flush();
+	}
+
+	void FdOutStream::WriteBlock(const char* Data, unsigned int BlockLength)
+	{
+		if (BlockLength <= INO_FDSTREAM_BUFFERSIZE - Length)
+		{
+			memcpy(Buffer + Length, Data, BlockLength);
+			Length += BlockLength;
+#ifdef INO_STREAMSTATS
+			AddOccupancy(Length);
+#endif
+			if (Length == INO_FDSTREAM_BUFFERSIZE || (LineBuffered && memchr(Data, '\n', BlockLength)))
+				Flush();
+			return;
+		}
+
+		iovec Vector[2];
+		Vector[0].iov_base = Buffer;
+		Vector[0].iov_len = Length;
+		Vector[1].iov_base = const_cast<char*>(Data);
+		Vector[1].iov_len = BlockLength;
+#ifdef INO_STREAMSTATS
+		unsigned long Start = INO_STREAMSTATS_MICROS();
+		WriteVector(Fd, Length ? Vector : Vector + 1, Length ? 2 : 1);
+		AddBlockedTime(Start);
+#else
+		WriteVector(Fd, Length ? Vector : Vector + 1, Length ? 2 : 1);
+#endif
+		Length = 0;
+	}
+
+	/**
+	 * @brief Writes the buffered characters.
+	 * @return Returns `false` if writing failed, the buffered characters are discarded anyway.
+	 */
+	bool FdOutStream::Flush()
+	{
+		if (!Length)
+			return true;
+		iovec Vector;
+		Vector.iov_base = Buffer;
+		Vector.iov_len = Length;
+		Length = 0;
+#ifdef INO_STREAMSTATS
+		unsigned long Start = INO_STREAMSTATS_MICROS();
+		bool Written = WriteVector(Fd, &Vector, 1);
+		AddBlockedTime(Start);
+		return Written;
+#else
+		return WriteVector(Fd, &Vector, 1);
+#endif
+	}
+
+	// * ----- FdInStream ---------------------------------------------------------------------------------------------------------
+
+	unsigned int FdInStream::Available() const
+	{
+		if (Begin == End)
+			Fill(0);
+		return End - Begin;
+	}
+
+	bool FdInStream::NoDataAvailable()
+	{
+		unsigned long ReadTimeout = GetActiveTimeout();
+		bool ReadTimeoutFirst = ReadTimeout && (Timeout < 0 || ReadTimeout < static_cast<unsigned long>(Timeout));
+		if (Fill(ReadTimeoutFirst ? static_cast<int>(ReadTimeout) : Timeout))
+			return true;
+		if (ReadTimeoutFirst && !EndOfFile)
+			TimedOut();
+		else
+			SetFailFlag(Fails::NoData);
+		return false;
+	}
+
+	/**
+	 * @brief Scans the buffer for the stop characters, refilling it without waiting as long as the file descriptor has data.
+	 */
+	void FdInStream::SkipBuffered(char StopA, char StopB, char StopC)
+	{
+		while (Begin < End || Fill(0))
+		{
+			unsigned int First = Begin;
+			for (; Begin < End; Begin++)
+			{
+				char Character = Buffer[Begin];
+				if (Character == StopA || Character == StopB || Character == StopC)
+					break;
+			}
+			AddSkipped(Begin - First);
+			if (Begin < End)
+				return;
+		}
+	}
+
+	/**
+	 * @brief Refills the empty buffer with a single `read()`, if the file descriptor becomes readable within `WaitTimeout` milliseconds.
+	 */
+	bool FdInStream::Fill(int WaitTimeout) const
+	{
+		if (EndOfFile)
+			return false;
+
+		pollfd Poll;
+		Poll.fd = Fd;
+		Poll.events = POLLIN;
+		Poll.revents = 0;
+		int Ready;
+		do
+			Ready = ::poll(&Poll, 1, WaitTimeout);
+		while (Ready < 0 && errno == EINTR);
+		if (Ready <= 0)
+			return false;
+
+		ssize_t Count;
+		do
+			Count = ::read(Fd, Buffer, INO_FDSTREAM_BUFFERSIZE);
+		while (Count < 0 && errno == EINTR);
+		if (Count <= 0)
+		{
+			if (Count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+				EndOfFile = true;
+			return false;
+		}
+		Begin = 0;
+		End = Count;
+		return true;
+	}
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+#pragma once
+#ifndef INO_FDSTREAM_INCLUDED
+#define INO_FDSTREAM_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "OutStream.h"
+#include "InStream.h"
+
+#ifndef INO_FDSTREAM_BUFFERSIZE
+#define INO_FDSTREAM_BUFFERSIZE 4096
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Buffered output stream to a POSIX file descriptor (host only).
+	 * @details
+	 * 	Characters are collected in a buffer of `INO_FDSTREAM_BUFFERSIZE` characters. Blocks that do not fit into the buffer are written together with the buffered characters by a single `writev()` call instead of being copied.
+	 * 	If the file descriptor is a terminal, the buffer is written at every line break.
+	 */
+	class FdOutStream : public OutStream
+	{
+	private:
+		int Fd;
+		bool LineBuffered;
+		unsigned int Length = 0;
+		char Buffer[INO_FDSTREAM_BUFFERSIZE];
+
+	protected:
+		virtual void Write(char Character) override;
+		virtual void WriteBlock(const char* Data, unsigned int BlockLength) override;
+
+	public:
+		FdOutStream(int Fd);
+		~FdOutStream();
+
+		FdOutStream(const FdOutStream&) = delete;
+		FdOutStream& operator=(const FdOutStream&) = delete;
+
+		inline int GetFd() const { return Fd; }
+		inline void SetLineBuffered(bool NewLineBuffered) { LineBuffered = NewLineBuffered; }
+
+		bool Flush();
+
+		// Same interface as ino::SerialOutStream, so sketches using ino::out build on host, the file descriptor needs no setup
+		inline void begin(unsigned long Baud, uint8_t Config = 0) { (void)Baud; (void)Config; }
+		inline void end() { Flush(); }
+		inline void flush() { Flush(); }
+
+	};
+
+	/**
+	 * @brief Buffered input stream from a POSIX file descriptor (host only).
+	 * @details
+	 * 	Available() checks with `poll()` whether the file descriptor is readable without waiting and refills the buffer with a single `read()`.
+	 * 	When no data is available, the stream waits with `poll()` for up to `Timeout` milliseconds (`-1` waits forever). At the end of the file or after the timeout the fail flag ino::InStream::Fails::NoData is set. A shorter read timeout (ino::InStream::SetReadTimeout) sets ino::InStream::Fails::Timeout instead.
+	 */
+	class FdInStream : public InStream
+	{
+	private:
+		int Fd;
+		int Timeout;
+		mutable bool EndOfFile = false;
+		mutable unsigned int Begin = 0;
+		mutable unsigned int End = 0;
+		mutable char Buffer[INO_FDSTREAM_BUFFERSIZE];
+
+		bool Fill(int WaitTimeout) const;
+
+	protected:
+		virtual bool NoDataAvailable() override;
+		virtual void SkipBuffered(char StopA, char StopB, char StopC) override;
+
+	public:
+		FdInStream(int Fd, int Timeout = -1) : Fd(Fd), Timeout(Timeout) {}
+
+		FdInStream(const FdInStream&) = delete;
+		FdInStream& operator=(const FdInStream&) = delete;
+
+		inline int GetFd() const { return Fd; }
+		inline void SetTimeout(int NewTimeout) { Timeout = NewTimeout; }
+		inline bool Eof() const { return EndOfFile && Begin == End; }
+
+		virtual inline bool PollReady() const override { return Available() || Eof(); }
+		virtual inline int PollFd() const override { return EndOfFile ? -1 : Fd; }
+
+		virtual inline char Peek() const override { return Begin < End ? Buffer[Begin] : '\0'; }
+		virtual unsigned int Available() const override;
+		virtual inline char Read() override { return Begin < End || Fill(0) ? Buffer[Begin++] : '\0'; }
+
+		// Same interface as ino::SerialInStream, so sketches using ino::in build on host
+		inline void begin(unsigned long Baud, uint8_t Config = 0) { (void)Baud; (void)Config; }
+		inline void end() {}
+
+	};
+
+}
+
+#endif
+
+#endif
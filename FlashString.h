@@ -0,0 +1,28 @@
+#pragma once
+#ifndef INO_FLASHSTRING_INCLUDED
+#define INO_FLASHSTRING_INCLUDED
+
+#include "InoCore.h"
+
+#include <Arduino.h>
+
+#ifdef INO_HOST
+// Host builds have no separate program memory, flash strings are plain pointers to ordinary memory
+
+class __FlashStringHelper;
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(Address) (*reinterpret_cast<const unsigned char*>(Address))
+#endif
+
+#ifndef F
+#define F(StringLiteral) (reinterpret_cast<const __FlashStringHelper*>(StringLiteral))
+#endif
+
+#endif
+
+#endif
@@ -3,11 +3,16 @@
 
 namespace ino {
 
+#ifdef INO_HOST
+	FdOutStream out(1);
+	FdInStream in(0);
+#else
 	SerialOutStream out(Serial);
 #ifdef INO_PLATFORMIOIN
 	PIOSerialInStream in(Serial);
 #else
 	SerialInStream in(Serial);
 #endif
+#endif
 
 }
\ No newline at end of file
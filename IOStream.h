@@ -3,20 +3,30 @@
 #define INO_IOSTREAM_INCLUDED
 
 #include "InoCore.h"
+#include "StreamRange.h"
+#ifdef INO_HOST
+#include "FdStream.h"
+#else
 #include "SerialInStream.h"
 #include "SerialOutStream.h"
 #ifdef INO_PLATFORMIOIN
 #include "PIOSerialInStream.h"
 #endif
+#endif
 
 namespace ino {
 	
+#ifdef INO_HOST
+	extern FdOutStream out;
+	extern FdInStream in;
+#else
 	extern SerialOutStream out;
 #ifdef INO_PLATFORMIOIN
 	extern PIOSerialInStream in;
 #else
 	extern SerialInStream in;
 #endif
+#endif
 
 }
 
@@ -9,29 +9,151 @@ namespace ino {
 	 */
 	bool InStream::CanRead()
 	{
-		if (Available())
+		if (TransferEnded)
 		{
+			if (!FirstRead)
+				return false;
+			TransferEnded = false;
+		}
+		unsigned int Count = Available();
+#ifdef INO_STREAMSTATS
+		if (Count > Stats.PeakOccupancy)
+			Stats.PeakOccupancy = Count > 0xFFFF ? 0xFFFF : Count;
+#endif
+		if (Count)
+		{
+#ifdef INO_PARSEERRORS
+			if (FirstRead)
+				TransferOffset = 0;
+#endif
 			if (TransferEnd != -1 && Peek() == TransferEnd)
 			{
-				Read();
+				InternalRead();
+				TransferEnded = true;
+				FirstRead = false;
 				return false;
 			}
+			else if (ElementEnd != -1 && Peek() == ElementEnd)
+				return false;
 			else
 			{
 				FirstRead = false;
 				return true;
 			}
 		}
+		// Without data the stream waits for the first character, with a timeout also for every further character up to the transfer end
+		else if ((FirstRead || (TransferEnd != -1 && GetActiveTimeout() && !Interrupted)) && TimedNoDataAvailable())
+			return CanRead();
 		else
+			return false;
+	}
+
+	/**
+	 * @brief Discards characters after a parse error according to the resync mode (see ino::InStream::SetResync), like ino::InStream::CanRead it stops at the transfer end and at the element end.
+	 */
+	void InStream::Resynchronize()
+	{
+		while (CanRead())
 		{
-			if (FirstRead && NoDataAvailable())
+			if (Peek() == ResyncChar)
 			{
-				FirstRead = false;
-				return true;
+				if (Resync == ResyncModes::NextDelimiter)
+					InternalRead();
+				return;
 			}
-			else
+			SkipBuffered(ResyncChar, TransferEnd != -1 ? TransferEnd : ResyncChar, ElementEnd != -1 ? ElementEnd : ResyncChar);
+		}
+	}
+
+	/**
+	 * @brief Discards available characters up to the first one that equals one of the stop characters, which stays in the stream. Does not wait for data.
+	 * @details Streams with a buffer override it with a scan over the buffer, they count the discarded characters with AddSkipped().
+	 */
+	void InStream::SkipBuffered(char StopA, char StopB, char StopC)
+	{
+		while (Available())
+		{
+			char Character = Peek();
+			if (Character == StopA || Character == StopB || Character == StopC)
+				return;
+			InternalRead();
+		}
+	}
+
+#ifdef INO_STREAMSTATS
+	/**
+	 * @brief Counts every fail flag in `Flag`, the counters saturate.
+	 */
+	void InStream::CountFails(Fails Flag)
+	{
+		auto Bits = static_cast<typename std::underlying_type<Fails>::type>(Flag);
+		for (uint8_t Bit = 0; Bits && Bit < sizeof(Stats.FailCounts) / sizeof(Stats.FailCounts[0]); Bit++, Bits >>= 1)
+		{
+			if ((Bits & 1) && Stats.FailCounts[Bit] != 0xFFFF)
+				Stats.FailCounts[Bit]++;
+		}
+	}
+
+	/**
+	 * @brief Calls ino::InStream::NoDataAvailable and adds the time spent in it to the blocked time of the stats.
+	 */
+	bool InStream::TimedNoDataAvailable()
+	{
+		unsigned long Start = INO_STREAMSTATS_MICROS();
+		bool Arrived = NoDataAvailable();
+		Stats.BlockedMicros += INO_STREAMSTATS_MICROS() - Start;
+		return Arrived;
+	}
+#endif
+
+#ifdef INO_PARSEERRORS
+	/**
+	 * @brief Fills the parse error record, unless it holds an earlier error already. Only called on the failure path.
+	 * @param Consumed The offending character and the `Count` - 1 characters after it, which were read already, or `nullptr` if the offending character is the next one.
+	 */
+	void InStream::NoteParseError(Fails Flag, ParseError::Operators Operator, ParseError::Tokens Expected, const char* Consumed, uint16_t Count)
+	{
+		if (Error.Fail)
+			return;
+		Error.Fail = static_cast<typename std::underlying_type<Fails>::type>(Flag);
+		Error.Operator = Operator;
+		Error.Expected = Expected;
+		if (Consumed && Count)
+		{
+			uint16_t Back = Count + (TransferEnded ? 1 : 0); // A word is read up to the transfer end
+			Error.Offset = TransferOffset >= Back ? TransferOffset - Back : 0;
+			Error.Offending = static_cast<uint8_t>(*Consumed);
+		}
+		else
+		{
+			Error.Offset = TransferOffset;
+			Error.Offending = !TransferEnded && Available() && Peek() != TransferEnd ? static_cast<uint8_t>(Peek()) : -1;
+		}
+	}
+#endif
+
+	/**
+	 * @brief Moves on to the next element of a range (see ino::Range), skipping the separator and leading blanks.
+	 * @return Returns `false` if the range ended with the transfer. An empty element sets the fail flag ino::InStream::Fails::WrongFormat.
+	 */
+	bool InStream::NextRangeElement(bool First)
+	{
+		if (!First)
+		{
+			if (TransferEnded || !Available() || Peek() != ElementEnd)
 				return false;
+			InternalRead();
 		}
+		while (CanRead())
+		{
+			char Character = Peek();
+			if (Character != ' ' && Character != '\t')
+				return true;
+			InternalRead();
+		}
+		if (!First || (Available() && Peek() == ElementEnd))
+			ParseFailed(Fails::WrongFormat, ParseError::Operators::Range, ParseError::Tokens::Element);
+		return false;
 	}
 
 	/**
@@ -50,10 +172,10 @@ namespace ino {
             return Character - 87;
         else
 		{
-            SetFailFlag(Fails::NotANumber);
-			ClearAndBreak();
+            ParseFailed(Fails::NotANumber, ParseError::Operators::Integer, ParseError::Tokens::Digit, Character);
+			ClearAndBreak(Character);
 		}
-        return 0;
+        return NoDigit;
     }
 
 	/**
@@ -75,8 +197,8 @@ namespace ino {
                 return Character - 55;
             else
 			{
-                SetFailFlag(Fails::WrongCase);
-				ClearAndBreak();
+                ParseFailed(Fails::WrongCase, ParseError::Operators::Integer, ParseError::Tokens::Letter, Character);
+				ClearAndBreak(Character);
 			}
         }
         else if (Character >= 'a' && Character <= 'z')
@@ -85,18 +207,35 @@ namespace ino {
                 return Character - 78;
             else
 			{
-                SetFailFlag(Fails::WrongCase);
-				ClearAndBreak();
+                ParseFailed(Fails::WrongCase, ParseError::Operators::Integer, ParseError::Tokens::Letter, Character);
+				ClearAndBreak(Character);
 			}
         }
         else
 		{
-            SetFailFlag(Fails::NotANumber);
-			ClearAndBreak();
+            ParseFailed(Fails::NotANumber, ParseError::Operators::Integer, ParseError::Tokens::Digit, Character);
+			ClearAndBreak(Character);
 		}
-        return 0;
+        return NoDigit;
     }
 
+	/**
+	 * @brief Compares a string that was read with a string of a format (ex. ino::BoolFormats), which is in program memory (PROGMEM) if `InFlash` is `true`.
+	 */
+	bool InStream::EqualsFormatString(const String& Str, const char* Data, bool InFlash)
+	{
+		if (!InFlash)
+			return Str == Data;
+
+		unsigned int C = 0;
+		for (; C < Str.length(); C++)
+		{
+			if (Str[C] != static_cast<char>(pgm_read_byte(Data + C)))
+				return false;
+		}
+		return pgm_read_byte(Data + C) == '\0';
+	}
+
 	/**
 	 * @brief Figures out the base of the data of the stream.
 	 * 	It checks wheather the data of the stream contains
@@ -110,9 +249,9 @@ namespace ino {
     BaseFormats InStream::GetBase()
     {
         if (Peek() == '0') {
-            Read();
+            InternalRead();
             if (Peek() == 'x') {
-                Read();
+                InternalRead();
 				constexpr static BaseFormats RetVal = BaseFormats(16, BaseFormats::Mode::PrefixFormat);
                 return RetVal;
             }
@@ -122,31 +261,32 @@ namespace ino {
 			}
         }
         else if (Peek() == 'B') {
-            Read();
+            InternalRead();
 			constexpr static BaseFormats RetVal = BaseFormats(2, BaseFormats::Mode::PrefixFormat);
             return RetVal;
         }
         else if (Peek() == '<') {
-            Read();
+            InternalRead();
             BaseFormats RetVal(0, BaseFormats::Mode::FullFormat);
 
             if (Peek() == 'B' || Peek() == 'b') {
-                Read();
+                InternalRead();
                 char Char = Peek();
                 while (Char >= '0' && Char <= '9') {
-                    Read();
+                    InternalRead();
                     RetVal.BaseVal = (RetVal.BaseVal * 10) + (Char - 48);
                     Char = Peek();
                 }
-                if (Read() != '>' || RetVal.BaseVal == 0)
+                char Close = InternalRead();
+                if (Close != '>' || RetVal.BaseVal == 0)
 				{
-                    SetFailFlag(Fails::WrongFormat);
+                    ParseFailed(Fails::WrongFormat, ParseError::Operators::Integer, ParseError::Tokens::BaseFormat, Close);
 					ClearAndBreak();
 				}
             }
             else
 			{
-                SetFailFlag(Fails::WrongFormat);
+                ParseFailed(Fails::WrongFormat, ParseError::Operators::Integer, ParseError::Tokens::BaseFormat);
 				ClearAndBreak();
 			}
             return RetVal;
@@ -155,6 +295,172 @@ namespace ino {
             return Fmt::Dec;
     }
 
+	/**
+	 * @brief Reads an unsigned integral in the given or (if `Base` is `nullptr`) detected base. Only instantiated for the 32 and 64 bit cores.
+	 * @details
+	 * 	If `Base` is given and the input specifies a different base, the fail flag ino::InStream::Fails::WrongBase is set (unless the number is 0).
+	 * 	A digit that is too large for the base sets the fail flag ino::InStream::Fails::WrongBase, the input operation is aborted and the stream is cleared.
+	 */
+	template <typename U>
+	bool InStream::ParseUnsigned(U& Num, const BaseFormats* Base, const CaseFormats* Case)
+	{
+		if (!CanRead())
+			return false;
+
+		Num = 0;
+		BaseFormats DetectedBase = GetBase();
+		uint8_t BaseVal = Base ? Base->BaseVal : DetectedBase.BaseVal;
+		if (Base && *Base != DetectedBase)
+			ParseFailed(Fails::WrongBase, ParseError::Operators::Integer, ParseError::Tokens::BaseFormat);
+		while (CanRead())
+		{
+			char Character = InternalRead();
+			uint8_t Digit = Case ? CharToNum(Character, *Case) : CharToNum(Character);
+			if (Digit == NoDigit)
+				break;
+			if (Digit >= BaseVal)
+			{
+				ParseFailed(Fails::WrongBase, ParseError::Operators::Integer, ParseError::Tokens::Digit, Character);
+				ClearAndBreak();
+				return true;
+			}
+			Num = (Num * BaseVal) + Digit;
+		}
+		if (Base && Num == 0)
+			ClearFailFlag(Fails::WrongBase);
+		return true;
+	}
+
+	/**
+	 * @brief Reads a decimal floating point number or a special number. Only instantiated for the `double` and `long double` cores.
+	 * @details
+	 * 	If `Decimalpoint` is `nullptr` both decimal point and decimal comma are allowed. With a precision other than ino::InStream::AnyPrecision, more decimals than the precision set the fail flag ino::InStream::Fails::WrongPrecision.
+	 */
+	template <typename T>
+	bool InStream::ParseFloat(T& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		if (!CanRead())
+			return false;
+
+		if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
+		{
+			String Str;
+			DefaultString(Str);
+			if (EqualsFormatString(Str, Specialnum.Nan, Specialnum.InFlash))
+				Num = NAN;
+			else if (EqualsFormatString(Str, Specialnum.PosInf, Specialnum.InFlash))
+				Num = INFINITY;
+			else if (EqualsFormatString(Str, Specialnum.NegInf, Specialnum.InFlash))
+				Num = -INFINITY;
+			else
+			{
+				ParseFailed(Fails::NotANumber, ParseError::Operators::Float, ParseError::Tokens::SpecialNumber, Str);
+				ClearAndBreak();
+				return false;
+			}
+			return true;
+		}
+
+		Num = 0;
+		bool Negative = GetSign();
+		uint8_t DecimalPlace = 0;
+		T Divisor = 1;
+		bool Malformed = false; // The sign is applied after a parse error too, so the value read so far keeps it
+		while (CanRead() && DecimalPlace <= Precision)
+		{
+			char Char = InternalRead();
+			if (Char == '.' || Char == ',')
+			{
+				if (Decimalpoint && (*Decimalpoint == Fmt::DecimalDot) != (Char == '.'))
+				{
+					ParseFailed(Fails::WrongDecimalPoint, ParseError::Operators::Float, ParseError::Tokens::DecimalPoint, Char);
+					ClearAndBreak(Char);
+					Malformed = true;
+					break;
+				}
+				if (DecimalPlace)
+				{
+					ParseFailed(Fails::NotANumber, ParseError::Operators::Float, ParseError::Tokens::Digit, Char);
+					ClearAndBreak(Char);
+					Malformed = true;
+					break;
+				}
+				DecimalPlace = 1;
+			}
+			else
+			{
+				if (Char < '0' || Char > '9')
+				{
+					ParseFailed(Fails::NotANumber, ParseError::Operators::Float, ParseError::Tokens::Digit, Char);
+					ClearAndBreak(Char);
+					Malformed = true;
+					break;
+				}
+				uint8_t Digit = Char - '0';
+				if (DecimalPlace)
+				{
+					DecimalPlace++;
+					Divisor *= 10;
+					Num += Digit / Divisor;
+				}
+				else
+					Num = (Num * 10) + Digit;
+			}
+		}
+		if (!Malformed && Precision != AnyPrecision && CanRead())
+		{
+			ParseFailed(Fails::WrongPrecision, ParseError::Operators::Float, ParseError::Tokens::TransferEnd);
+			ClearAndBreak();
+		}
+		if (Negative)
+			Num = -Num;
+		return true;
+	}
+
+	// * ----- Parsing cores -----------------------------------------------------------------------------------------------------
+
+	bool InStream::UnsignedCore(uint32_t& Num, const BaseFormats* Base, const CaseFormats* Case)
+	{
+		return ParseUnsigned(Num, Base, Case);
+	}
+
+	bool InStream::UnsignedCore(uint64_t& Num, const BaseFormats* Base, const CaseFormats* Case)
+	{
+		return ParseUnsigned(Num, Base, Case);
+	}
+
+	bool InStream::SignedCore(int32_t& Num, const BaseFormats* Base, const CaseFormats* Case)
+	{
+		if (!CanRead())
+			return false;
+		bool Negative = GetSign();
+		uint32_t Magnitude = 0;
+		UnsignedCore(Magnitude, Base, Case);
+		Num = static_cast<int32_t>(Negative ? static_cast<uint32_t>(0) - Magnitude : Magnitude);
+		return true;
+	}
+
+	bool InStream::SignedCore(int64_t& Num, const BaseFormats* Base, const CaseFormats* Case)
+	{
+		if (!CanRead())
+			return false;
+		bool Negative = GetSign();
+		uint64_t Magnitude = 0;
+		UnsignedCore(Magnitude, Base, Case);
+		Num = static_cast<int64_t>(Negative ? static_cast<uint64_t>(0) - Magnitude : Magnitude);
+		return true;
+	}
+
+	bool InStream::FloatCore(double& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		return ParseFloat(Num, Decimalpoint, Precision, Specialnum);
+	}
+
+	bool InStream::FloatCore(long double& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		return ParseFloat(Num, Decimalpoint, Precision, Specialnum);
+	}
+
     //-------- Default input operators (depended on input) ------------------------------------
       //------ non-const non-volatile ---------------------------------------------------------
 
@@ -165,11 +471,12 @@ namespace ino {
 	 *	Use Read() instead to get a single character from the stream without clearing the stream afterwards.
 	 */
     InStream& InStream::operator>>(char& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		if (CanRead())
-       		Data = Read();
+       		Data = InternalRead();
 		if (CanRead())
 		{
-			SetFailFlag(Fails::NotAChar);
+			ParseFailed(Fails::NotAChar, ParseError::Operators::Char, ParseError::Tokens::TransferEnd);
 			ClearAndBreak();
 		}
 		FinishTransfer();
@@ -184,6 +491,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
 	InStream& InStream::operator>>(signed char& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
         return *this;
@@ -199,6 +507,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(unsigned char& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -212,6 +521,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(short& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -227,6 +537,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(unsigned short& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -240,6 +551,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(int& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -255,6 +567,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(unsigned int& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -268,6 +581,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -283,6 +597,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(unsigned long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -296,6 +611,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(long long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -311,6 +627,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(unsigned long long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -324,6 +641,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(float& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -337,6 +655,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(double& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -350,6 +669,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(long double& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -362,6 +682,7 @@ namespace ino {
 	 * 	Any other input leads to fail flag ino::InStream::Fails::NotABool being set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(bool& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultBool(Data);
 		FinishTransfer();
 		return *this;
@@ -371,6 +692,7 @@ namespace ino {
 	 * @brief Input operator for `String`. Reads the input as string.
 	 */
     InStream& InStream::operator>>(String& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultString(Data);
 		FinishTransfer();
 		return *this;
@@ -384,11 +706,12 @@ namespace ino {
 	 * 	If the input is more than one character, the fail flag ino::InStream::Fails::NotAChar is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile char& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		if (CanRead())
-       		Data = Read();
+       		Data = InternalRead();
 		if (CanRead())
 		{
-			SetFailFlag(Fails::NotAChar);
+			ParseFailed(Fails::NotAChar, ParseError::Operators::Char, ParseError::Tokens::TransferEnd);
 			ClearAndBreak();
 		}
 		FinishTransfer();
@@ -403,6 +726,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
 	InStream& InStream::operator>>(volatile signed char& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
         return *this;
@@ -418,6 +742,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile unsigned char& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -431,6 +756,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile short& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -446,6 +772,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile unsigned short& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -459,6 +786,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile int& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -474,6 +802,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile unsigned int& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -487,6 +816,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -502,6 +832,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile unsigned long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -515,6 +846,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the FailFlag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile long long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -530,6 +862,7 @@ namespace ino {
 	 * 	- specify it's base (see ino::BaseFormats). If the input and the specified base do not match, the fail flag ino::InStream::Fails::WrongBase is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile unsigned long long& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
@@ -543,6 +876,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile float& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -556,6 +890,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile double& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -569,6 +904,7 @@ namespace ino {
 	 * 	- If the input contains characters that aren't decimal digits or if the input contains multiple decimal points or commas, the fail flag ino::InStream::Fails::NotANumber is set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile long double& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
@@ -581,6 +917,7 @@ namespace ino {
 	 * 	Any other input leads to fail flag ino::InStream::Fails::NotABool being set, the input operation is aborted and the stream is cleared.
 	 */
     InStream& InStream::operator>>(volatile bool& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultBool(Data);
 		FinishTransfer();
 		return *this;
@@ -590,6 +927,7 @@ namespace ino {
 	 * @brief Input operator for `volatile String`. Reads the input as string.
 	 */
     InStream& InStream::operator>>(volatile String& Data) {
+        INO_STREAMTRACE_OPERATOR();
         DefaultString(Data);
 		FinishTransfer();
 		return *this;
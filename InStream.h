@@ -3,8 +3,11 @@
 #define INO_INSTREAM_INCLUDED
 
 #include "InoCore.h"
+#include "ParseError.h"
 #include "StreamBase.h"
+#include "StreamStats.h"
 #include "Utility.h"
+#include "WaitStrategy.h"
 #include "std/TypeTraits.h"
 
 #include <Arduino.h>
@@ -28,28 +31,169 @@ namespace ino {
 			WrongPrecision = INO_INSTREAM_BIT(8),
 			WrongCString = INO_INSTREAM_BIT(10),
 			NoData = INO_INSTREAM_BIT(11),
+			Timeout = INO_INSTREAM_BIT(12),
+		};
+
+		// How the stream recovers after a parse error, see ino::InStream::SetResync
+		enum class ResyncModes : uint8_t {
+			Drain,			// Discards the rest of the transfer, without a transfer end everything available
+			NextDelimiter,	// Discards up to and including the next resync character
+			NextFrameStart,	// Discards up to the next resync character, which stays in the stream as start of the next frame
 		};
 
 	private:
-		Fails FailFlags;
+		Fails FailFlags = Fails::NoFail;
 		bool FirstRead = true;
+		bool TransferEnded = false; // The transfer end has been read, but the transfer is not finished yet
+		char ElementEnd = -1;
+		WaitStrategy Wait;
+		unsigned long ReadTimeout = 0;
+		unsigned long CallTimeout = 0;
+		bool Interrupted = false; // A timeout interrupted the current operator
+		ResyncModes Resync = ResyncModes::Drain;
+		char ResyncChar = '\n';
+
+#ifdef INO_STREAMSTATS
+		InStreamStats Stats;
+		void CountFails(Fails Flag);
+		bool TimedNoDataAvailable();
+#else
+		inline bool TimedNoDataAvailable() { return NoDataAvailable(); }
+#endif
+#ifdef INO_PARSEERRORS
+		ParseError Error;
+		uint16_t TransferOffset = 0; // Characters of the transfer read so far
+		void NoteParseError(Fails Flag, ParseError::Operators Operator, ParseError::Tokens Expected, const char* Consumed, uint16_t Count);
+#endif
 		
 	protected:
+#ifdef INO_STREAMSTATS
+		inline void SetFailFlag(Fails Flag) { CountFails(Flag); FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) | static_cast<typename std::underlying_type<Fails>::type>(Flag)); }
+#else
 		inline void SetFailFlag(Fails Flag) { FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) | static_cast<typename std::underlying_type<Fails>::type>(Flag)); }
+#endif
+		inline char InternalRead()
+		{
+#ifdef INO_STREAMSTATS
+			Stats.Bytes++;
+#endif
+#ifdef INO_PARSEERRORS
+			TransferOffset++;
+#endif
+			return Read();
+		}
+		// For derived streams that discard characters without reading them (ino::InStream::SkipBuffered), counts them like InternalRead() does
+#if defined(INO_STREAMSTATS) || defined(INO_PARSEERRORS)
+		inline void AddSkipped(unsigned int Count)
+		{
+#ifdef INO_STREAMSTATS
+			Stats.Bytes += Count;
+#endif
+#ifdef INO_PARSEERRORS
+			TransferOffset += Count;
+#endif
+		}
+#else
+		inline void AddSkipped(unsigned int) {}
+#endif
+
+		// Set the fail flag of a parse error, with INO_PARSEERRORS also the ino::ParseError record: the offending character is the next one, the last one read (`Consumed`) or the first one of a word that was read
+#ifdef INO_PARSEERRORS
+		inline void ParseFailed(Fails Flag, ParseError::Operators Operator, ParseError::Tokens Expected) { NoteParseError(Flag, Operator, Expected, nullptr, 0); SetFailFlag(Flag); }
+		inline void ParseFailed(Fails Flag, ParseError::Operators Operator, ParseError::Tokens Expected, char Consumed) { NoteParseError(Flag, Operator, Expected, &Consumed, 1); SetFailFlag(Flag); }
+		inline void ParseFailed(Fails Flag, ParseError::Operators Operator, ParseError::Tokens Expected, const String& Word) { NoteParseError(Flag, Operator, Expected, Word.c_str(), Word.length()); SetFailFlag(Flag); }
+#else
+		inline void ParseFailed(Fails Flag, ParseError::Operators, ParseError::Tokens) { SetFailFlag(Flag); }
+		inline void ParseFailed(Fails Flag, ParseError::Operators, ParseError::Tokens, char) { SetFailFlag(Flag); }
+		inline void ParseFailed(Fails Flag, ParseError::Operators, ParseError::Tokens, const String&) { SetFailFlag(Flag); }
+#endif
 		virtual inline bool NoDataAvailable() { SetFailFlag(Fails::NoData); return false; }
 
+		/**
+		 * @brief Waits with the wait strategy of the stream until `Ready()` returns `true`, for streams that wait for data in ino::InStream::NoDataAvailable.
+		 * @return Returns `false` and sets the fail flag ino::InStream::Fails::Timeout if the timeout of the operator passed (see ino::InStream::SetReadTimeout) or ino::InStream::Fails::NoData if the deadline of the wait strategy passed.
+		 */
+		template <typename ReadyT>
+		bool WaitUntil(ReadyT Ready)
+		{
+			unsigned long Timeout = GetActiveTimeout();
+			unsigned long Start = Wait.Deadline || Timeout ? Clock::Millis() : 0;
+			while (!Ready())
+			{
+				if (Wait.Deadline || Timeout)
+				{
+					unsigned long Waited = Clock::Millis() - Start;
+					if (Timeout && Waited >= Timeout)
+					{
+						TimedOut();
+						return false;
+					}
+					if (Wait.Deadline && Waited >= Wait.Deadline)
+					{
+						SetFailFlag(Fails::NoData);
+						return false;
+					}
+				}
+				Wait.Pause();
+			}
+			return true;
+		}
+
+		inline unsigned long GetActiveTimeout() const { return CallTimeout ? CallTimeout : ReadTimeout; }
+		inline void TimedOut() { Interrupted = true; SetFailFlag(Fails::Timeout); }
+
 	public:
 		inline bool Failed() const { return FailFlags != Fails::NoFail; }
 		inline bool Failed(Fails TestFlag) const { return static_cast<typename std::underlying_type<Fails>::type>(FailFlags) & static_cast<typename std::underlying_type<Fails>::type>(TestFlag); }
+		inline Fails GetFails() const { return FailFlags; }
+
+		inline void SetWait(const WaitStrategy& NewWait) { Wait = NewWait; }
+		inline const WaitStrategy& GetWait() const { return Wait; }
+
+		// Recovery after a parse error, the transfer end and the element end of ino::Range always stop discarding, ex. `ino::in.SetResync(ino::InStream::ResyncModes::NextDelimiter, ';');`
+		inline void SetResync(ResyncModes Mode, char Character = '\n') { Resync = Mode; ResyncChar = Character; }
+		inline ResyncModes GetResyncMode() const { return Resync; }
+		inline char GetResyncChar() const { return ResyncChar; }
 
+		// Longest wait in milliseconds for the first character of every operator and for every following character of the transfer, `0` waits forever (see ino::InStream::Fails::Timeout)
+		inline void SetReadTimeout(unsigned long Millis) { ReadTimeout = Millis; }
+		inline unsigned long GetReadTimeout() const { return ReadTimeout; }
+		// Timeout of the next operator only, ex. `ino::in.WithTimeout(50) >> Value;`
+		inline InStream& WithTimeout(unsigned long Millis) { CallTimeout = Millis; return *this; }
+
+#ifdef INO_PARSEERRORS
+		inline void ClearFails() { FailFlags = Fails::NoFail; Error = ParseError(); }
+		inline void ClearFailFlag(Fails Flag)
+		{
+			FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) & ~static_cast<typename std::underlying_type<Fails>::type>(Flag));
+			if (Error.Fail & static_cast<typename std::underlying_type<Fails>::type>(Flag))
+				Error = ParseError();
+		}
+		// First parse error since ino::InStream::ClearFails, ex. `ino::out << ino::in.GetParseError();`
+		inline const ParseError& GetParseError() const { return Error; }
+#else
 		inline void ClearFails() { FailFlags = Fails::NoFail; }
 		inline void ClearFailFlag(Fails Flag) { FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) & ~static_cast<typename std::underlying_type<Fails>::type>(Flag)); }
+#endif
 
 		virtual char Peek() const = 0;
 		virtual unsigned int Available() const = 0;
 		virtual char Read() = 0;
 
-		inline void Clear() { while (CanRead()) Read(); FinishTransfer(); }
+		// Readiness for ino::Poll, streams that end (ex. at the end of a file) are ready as well, because reading returns at once
+		virtual inline bool PollReady() const { return Available() != 0; }
+#ifdef INO_HOST
+		// File descriptor ino::Poll waits on with `poll()`, `-1` if the stream has none
+		virtual inline int PollFd() const { return -1; }
+#endif
+
+		inline bool WaitForData() { return Available() || TimedNoDataAvailable(); }
+		inline void Clear() { while (CanRead()) InternalRead(); FinishTransfer(); }
+
+#ifdef INO_STREAMSTATS
+		inline InStreamStats GetStats() const { return Stats; }
+		inline void ResetStats() { Stats = InStreamStats(); }
+#endif
 
 		// * ----- Default input operators (depended on input) --------------------------------------------------------------------
 		  //------ non-const non-volatile -----------------------------------------------------------------------------------------
@@ -194,18 +338,33 @@ namespace ino {
 		template <typename T, typename... FmtTs, typename std::enable_if<(std::is_same<char*, typename ReduceTypeExceptConst<T>::type>::value || IsElementTypeConsiderConst<char, T>::value) && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<CStringFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type = 0>
 		InStream& operator>>(const MultiFormat<T, FmtTs...>& Data);
 
+		  //------ Range input operator (defined in StreamRange.h) -------------------------------------------------------------------
+
+		template <typename T, typename... FmtTs, typename std::enable_if<(std::is_integral<T>::value || std::is_floating_point<T>::value) && !std::is_same<bool, typename std::remove_cv<T>::type>::value && !std::is_same<char, typename std::remove_cv<T>::type>::value && !std::is_const<T>::value, int>::type = 0>
+		InStream& operator>>(const RangeFormat<T, FmtTs...>& Data);
+
+
+	private:
+		bool NextRangeElement(bool First);
+
+		template <typename U>
+		bool ParseUnsigned(U& Num, const BaseFormats* Base, const CaseFormats* Case);
+		template <typename T>
+		bool ParseFloat(T& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
 
 	protected: // Helper functions
 		inline bool GetSign()
 		{
 			if (Peek() == '-')
 			{
-				Read();
+				InternalRead();
 				return true;
 			}
 			return false;
 		}
+		constexpr static uint8_t NoDigit = 0xFF; // Returned by CharToNum when the character is no digit, the fail flag is set and the stream resynchronized already
 		uint8_t CharToNum(char Character);
+		static bool EqualsFormatString(const String& Str, const char* Data, bool InFlash);
 		uint8_t CharToNum(char Character, const CaseFormats& Case);
 		BaseFormats GetBase();
 
@@ -214,672 +373,108 @@ namespace ino {
 
 		inline void ClearAndBreak()
 		{
-			while(CanRead()) Read();
+			if (Resync == ResyncModes::Drain)
+				while(CanRead()) InternalRead();
+			else
+				Resynchronize();
 		}
+		// After a parse error on a character that was read already: if it was the resync delimiter, the stream is in sync again
+		inline void ClearAndBreak(char Consumed)
+		{
+			if (Resync != ResyncModes::NextDelimiter || Consumed != ResyncChar)
+				ClearAndBreak();
+		}
+		void Resynchronize();
+		virtual void SkipBuffered(char StopA, char StopB, char StopC);
 
 		inline void FinishTransfer()
 		{
+#ifdef INO_STREAMSTATS
+			Stats.Transfers++;
+#endif
 			FirstRead = true;
+			Interrupted = false;
+			CallTimeout = 0;
+#ifdef INO_STREAMTRACE
+			TraceTransfer();
+#endif
 		}
 
+		// Every integral type is read by the 32 or 64 bit core, every floating point type by the `double` or `long double` core
 		template <typename T>
-		inline void DefaultUnsignedInt(T&& Data)
-		{
-			if (CanRead())
-			{
-				Data = 0;
-				auto Base = GetBase();
-				while (CanRead())
-				{
-					auto Num = CharToNum(Read());
-					if (Num >= Base.BaseVal)
-					{
-						SetFailFlag(Fails::WrongBase);
-						ClearAndBreak();
-						return;
-					}
-					Data = (Data * Base.BaseVal) + Num;
-				}
-			}
-		}
+		using UnsignedCoreType = typename std::conditional<(sizeof(typename std::decay<T>::type) > 4), uint64_t, uint32_t>::type;
+		template <typename T>
+		using SignedCoreType = typename std::conditional<(sizeof(typename std::decay<T>::type) > 4), int64_t, int32_t>::type;
 		template <typename T>
-		inline void DefaultUnsignedInt(T&& Data, const BaseFormats& Base)
+		using FloatCoreType = typename std::conditional<(sizeof(typename std::decay<T>::type) > sizeof(double)), long double, double>::type;
+
+		constexpr static uint8_t AnyPrecision = 0xFF; // Precision argument of FloatCore(), any number of decimals is accepted
+
+		// Out-of-line parsing cores (InStream.cpp), formats that are not specified are passed as `nullptr`
+		// They return `false` if nothing was read and the target must not be assigned
+		bool UnsignedCore(uint32_t& Num, const BaseFormats* Base, const CaseFormats* Case);
+		bool UnsignedCore(uint64_t& Num, const BaseFormats* Base, const CaseFormats* Case);
+		bool SignedCore(int32_t& Num, const BaseFormats* Base, const CaseFormats* Case);
+		bool SignedCore(int64_t& Num, const BaseFormats* Base, const CaseFormats* Case);
+		bool FloatCore(double& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
+		bool FloatCore(long double& Num, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
+
+		template <typename T>
+		inline void ReadUnsignedInt(T&& Data, const BaseFormats* Base, const CaseFormats* Case)
 		{
-			if (CanRead())
-			{
-				Data = 0;
-				auto DetcBase = GetBase();
-				if (Base != DetcBase)
-					SetFailFlag(Fails::WrongBase);
-				while (CanRead())
-				{
-					auto Num = CharToNum(Read());
-					if (Num >= Base.BaseVal)
-					{
-						SetFailFlag(Fails::WrongBase);
-						ClearAndBreak();
-						return;
-					}
-					Data = (Data * Base.BaseVal) + Num;
-				}
-				if (Data == 0)
-					ClearFailFlag(Fails::WrongBase);
-			}
+			UnsignedCoreType<T> Num;
+			if (UnsignedCore(Num, Base, Case) && !Interrupted) // A number cut off by a timeout is not stored
+				Data = static_cast<typename std::decay<T>::type>(Num);
 		}
 		template <typename T>
-		inline void DefaultUnsignedInt(T&& Data, const CaseFormats& Case)
+		inline void ReadSignedInt(T&& Data, const BaseFormats* Base, const CaseFormats* Case)
 		{
-			if (CanRead())
-			{
-				Data = 0;
-				auto Base = GetBase();
-				while (CanRead())
-				{
-					auto Num = CharToNum(Read(), Case);
-					if (Num > Base.BaseVal)
-					{
-						SetFailFlag(Fails::WrongBase);
-						ClearAndBreak();
-						return;
-					}
-					Data = (Data * Base.BaseVal) + Num;
-				}
-			}
+			SignedCoreType<T> Num;
+			if (SignedCore(Num, Base, Case) && !Interrupted)
+				Data = static_cast<typename std::decay<T>::type>(Num);
 		}
 		template <typename T>
-		inline void DefaultUnsignedInt(T&& Data, const BaseFormats& Base, const CaseFormats& Case)
+		inline void ReadFloat(T&& Data, const DecimalpointFormats* Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
 		{
-			if (CanRead())
-			{
-				Data = 0;
-				auto DetcBase = GetBase();
-				if (Base != DetcBase)
-					SetFailFlag(Fails::WrongBase);
-				while (CanRead())
-				{
-					auto Num = CharToNum(Read(), Case);
-					if (Num >= Base.BaseVal)
-					{
-						SetFailFlag(Fails::WrongBase);
-						ClearAndBreak();
-						return;
-					}
-					Data = (Data * Base.BaseVal) + Num;
-				}
-				if (Data == 0)
-					ClearFailFlag(Fails::WrongBase);
-			}
+			FloatCoreType<T> Num;
+			if (FloatCore(Num, Decimalpoint, Precision, Specialnum) && !Interrupted)
+				Data = static_cast<typename std::decay<T>::type>(Num);
 		}
 
 		template <typename T>
-		inline void DefaultSignedInt(T&& Data)
-		{
-			if (CanRead())
-			{
-				Data = 0;
-				bool Negative = GetSign();
-				DefaultUnsignedInt(Data);
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultUnsignedInt(T&& Data) { ReadUnsignedInt(Data, nullptr, nullptr); }
 		template <typename T>
-		inline void DefaultSignedInt(T&& Data, const BaseFormats& Base)
-		{
-			if (CanRead())
-			{
-				Data = 0;
-				bool Negative = GetSign();
-				DefaultUnsignedInt(Data, Base);
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultUnsignedInt(T&& Data, const BaseFormats& Base) { ReadUnsignedInt(Data, &Base, nullptr); }
 		template <typename T>
-		inline void DefaultSignedInt(T&& Data, const CaseFormats& Case)
-		{
-			if (CanRead())
-			{
-				Data = 0;
-				bool Negative = GetSign();
-				DefaultUnsignedInt(Data, Case);
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultUnsignedInt(T&& Data, const CaseFormats& Case) { ReadUnsignedInt(Data, nullptr, &Case); }
 		template <typename T>
-		inline void DefaultSignedInt(T&& Data, const BaseFormats& Base, const CaseFormats& Case)
-		{
-			if (CanRead())
-			{
-				Data = 0;
-				bool Negative = GetSign();
-				DefaultUnsignedInt(Data, Base, Case);
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultUnsignedInt(T&& Data, const BaseFormats& Base, const CaseFormats& Case) { ReadUnsignedInt(Data, &Base, &Case); }
 
 		template <typename T>
-		inline void DefaultFloat(T&& Data)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Fmt::SpecialnumberShort.Nan)
-						Data = NAN;
-					else if (Str == Fmt::SpecialnumberShort.PosInf)
-						Data = INFINITY;
-					else if (Str == Fmt::SpecialnumberShort.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead())
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultSignedInt(T&& Data) { ReadSignedInt(Data, nullptr, nullptr); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Fmt::SpecialnumberShort.Nan)
-						Data = NAN;
-					else if (Str == Fmt::SpecialnumberShort.PosInf)
-						Data = INFINITY;
-					else if (Str == Fmt::SpecialnumberShort.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead())
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if ((Decimalpoint == Fmt::DecimalDot && Char != '.') || (Decimalpoint == Fmt::DecimalComma && Char != ','))
-						{
-							SetFailFlag(Fails::WrongDecimalPoint);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultSignedInt(T&& Data, const BaseFormats& Base) { ReadSignedInt(Data, &Base, nullptr); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const PrecisionFormats& Precision)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Fmt::SpecialnumberShort.Nan)
-						Data = NAN;
-					else if (Str == Fmt::SpecialnumberShort.PosInf)
-						Data = INFINITY;
-					else if (Str == Fmt::SpecialnumberShort.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-				
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead() && DecimalPlace <= Precision.PrecisionVal)
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (CanRead())
-				{
-					SetFailFlag(Fails::WrongPrecision);
-					ClearAndBreak();
-					return;
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultSignedInt(T&& Data, const CaseFormats& Case) { ReadSignedInt(Data, nullptr, &Case); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const SpecialnumberFormats& Specialnum)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Specialnum.Nan)
-						Data = NAN;
-					else if (Str == Specialnum.PosInf)
-						Data = INFINITY;
-					else if (Str == Specialnum.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
+		inline void DefaultSignedInt(T&& Data, const BaseFormats& Base, const CaseFormats& Case) { ReadSignedInt(Data, &Base, &Case); }
 
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead())
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Fmt::SpecialnumberShort.Nan)
-						Data = NAN;
-					else if (Str == Fmt::SpecialnumberShort.PosInf)
-						Data = INFINITY;
-					else if (Str == Fmt::SpecialnumberShort.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead() && DecimalPlace <= Precision.PrecisionVal)
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if ((Decimalpoint == Fmt::DecimalDot && Char != '.') || (Decimalpoint == Fmt::DecimalComma && Char != ','))
-						{
-							SetFailFlag(Fails::WrongDecimalPoint);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (CanRead())
-				{
-					SetFailFlag(Fails::WrongPrecision);
-					ClearAndBreak();
-					return;
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultFloat(T&& Data) { ReadFloat(Data, nullptr, AnyPrecision, Fmt::SpecialnumberShort); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const SpecialnumberFormats& Specialnum)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Specialnum.Nan)
-						Data = NAN;
-					else if (Str == Specialnum.PosInf)
-						Data = INFINITY;
-					else if (Str == Specialnum.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead())
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if ((Decimalpoint == Fmt::DecimalDot && Char != '.') || (Decimalpoint == Fmt::DecimalComma && Char != ','))
-						{
-							SetFailFlag(Fails::WrongDecimalPoint);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint) { ReadFloat(Data, &Decimalpoint, AnyPrecision, Fmt::SpecialnumberShort); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Specialnum.Nan)
-						Data = NAN;
-					else if (Str == Specialnum.PosInf)
-						Data = INFINITY;
-					else if (Str == Specialnum.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-				
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead() && DecimalPlace <= Precision.PrecisionVal)
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + CharToNum(Digit);
-					}
-				}
-				if (CanRead())
-				{
-					SetFailFlag(Fails::WrongPrecision);
-					ClearAndBreak();
-					return;
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultFloat(T&& Data, const PrecisionFormats& Precision) { ReadFloat(Data, nullptr, Precision.PrecisionVal, Fmt::SpecialnumberShort); }
 		template <typename T>
-		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum)
-		{
-			if (CanRead())
-			{
-				if ((Peek() < '0' || Peek() > '9') && Peek() != '-')
-				{
-					String Str;
-					DefaultString(Str);
-					if (Str == Specialnum.Nan)
-						Data = NAN;
-					else if (Str == Specialnum.PosInf)
-						Data = INFINITY;
-					else if (Str == Specialnum.NegInf)
-						Data = -INFINITY;
-					else
-					{
-						SetFailFlag(Fails::NotANumber);
-						ClearAndBreak();
-						return;
-					}
-					return;
-				}
-				
-				Data = 0;
-				bool Negative = GetSign();
-				uint8_t DecimalPlace = 0;
-				while (CanRead() && DecimalPlace <= Precision.PrecisionVal)
-				{
-					auto Char = Read();
-					if (Char == '.' || Char == ',')
-					{
-						if ((Decimalpoint == Fmt::DecimalDot && Char != '.') || (Decimalpoint == Fmt::DecimalComma && Char != ','))
-						{
-							SetFailFlag(Fails::WrongDecimalPoint);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						DecimalPlace = 1;
-					}
-					else
-					{
-						auto Digit = CharToNum(Char);
-						if (Digit >= 10)
-						{
-							SetFailFlag(Fails::NotANumber);
-							ClearAndBreak();
-							return;
-						}
-						if (DecimalPlace)
-							Data += static_cast<typename std::decay<T>::type>(Digit) / Power(10, DecimalPlace++);
-						else
-							Data = (Data * 10) + Digit;
-					}
-				}
-				if (CanRead())
-				{
-					SetFailFlag(Fails::WrongPrecision);
-					ClearAndBreak();
-					return;
-				}
-				if (Negative)
-					Data = -Data;
-			}
-		}
+		inline void DefaultFloat(T&& Data, const SpecialnumberFormats& Specialnum) { ReadFloat(Data, nullptr, AnyPrecision, Specialnum); }
+		template <typename T>
+		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision) { ReadFloat(Data, &Decimalpoint, Precision.PrecisionVal, Fmt::SpecialnumberShort); }
+		template <typename T>
+		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const SpecialnumberFormats& Specialnum) { ReadFloat(Data, &Decimalpoint, AnyPrecision, Specialnum); }
+		template <typename T>
+		inline void DefaultFloat(T&& Data, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum) { ReadFloat(Data, nullptr, Precision.PrecisionVal, Specialnum); }
+		template <typename T>
+		inline void DefaultFloat(T&& Data, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum) { ReadFloat(Data, &Decimalpoint, Precision.PrecisionVal, Specialnum); }
 
 		template <typename T>
 		inline void DefaultBool(T&& Data)
@@ -889,10 +484,10 @@ namespace ino {
 				if (Peek() == '0')
 				{
 					Data = false;
-					Read();
+					InternalRead();
 					if (CanRead())
 					{
-						SetFailFlag(Fails::NotABool);
+						ParseFailed(Fails::NotABool, ParseError::Operators::Bool, ParseError::Tokens::TransferEnd);
 						ClearAndBreak();
 						return;
 					}
@@ -900,10 +495,10 @@ namespace ino {
 				else if (Peek() == '1')
 				{
 					Data = true;
-					Read();
+					InternalRead();
 					if (CanRead())
 					{
-						SetFailFlag(Fails::NotABool);
+						ParseFailed(Fails::NotABool, ParseError::Operators::Bool, ParseError::Tokens::TransferEnd);
 						ClearAndBreak();
 						return;
 					}
@@ -912,12 +507,12 @@ namespace ino {
 				{
 					String Bool;
 					DefaultString(Bool);
-					if (Bool == Fmt::BoolWord.BoolTrue || Bool == Fmt::BoolCapital.BoolTrue || Bool == Fmt::BoolCaps.BoolTrue)
+					if (EqualsFormatString(Bool, Fmt::BoolWord.BoolTrue, Fmt::BoolWord.InFlash) || EqualsFormatString(Bool, Fmt::BoolCapital.BoolTrue, Fmt::BoolCapital.InFlash) || EqualsFormatString(Bool, Fmt::BoolCaps.BoolTrue, Fmt::BoolCaps.InFlash))
 						Data = true;
-					else if (Bool == Fmt::BoolWord.BoolFalse || Bool == Fmt::BoolCapital.BoolFalse || Bool == Fmt::BoolCaps.BoolFalse)
+					else if (EqualsFormatString(Bool, Fmt::BoolWord.BoolFalse, Fmt::BoolWord.InFlash) || EqualsFormatString(Bool, Fmt::BoolCapital.BoolFalse, Fmt::BoolCapital.InFlash) || EqualsFormatString(Bool, Fmt::BoolCaps.BoolFalse, Fmt::BoolCaps.InFlash))
 						Data = false;
 					else
-						SetFailFlag(Fails::NotABool);
+						ParseFailed(Fails::NotABool, ParseError::Operators::Bool, ParseError::Tokens::BoolWord, Bool);
 				}
 			}
 		}
@@ -926,12 +521,12 @@ namespace ino {
 		{
 			String Bool;
 			DefaultString(Bool);
-			if (Bool == BoolWord.BoolTrue)
+			if (EqualsFormatString(Bool, BoolWord.BoolTrue, BoolWord.InFlash))
 				Data = true;
-			else if (Bool == BoolWord.BoolFalse)
+			else if (EqualsFormatString(Bool, BoolWord.BoolFalse, BoolWord.InFlash))
 				Data = false;
 			else
-				SetFailFlag(Fails::NotABool);
+				ParseFailed(Fails::NotABool, ParseError::Operators::Bool, ParseError::Tokens::BoolWord, Bool);
 		}
 
 		template <typename T>
@@ -939,16 +534,16 @@ namespace ino {
 		{
 			if (CanRead())
 			{
-				Data = Read();
+				Data = InternalRead();
 				if (Case == Fmt::Uppercase && (Data >= 'a' && Data <= 'z'))
 				{
-					SetFailFlag(Fails::WrongCase);
+					ParseFailed(Fails::WrongCase, ParseError::Operators::Char, ParseError::Tokens::Letter, static_cast<char>(Data));
 					ClearAndBreak();
 					return;
 				}
 				else if (Case == Fmt::Lowercase && (Data >= 'A' && Data <= 'Z'))
 				{
-					SetFailFlag(Fails::WrongCase);
+					ParseFailed(Fails::WrongCase, ParseError::Operators::Char, ParseError::Tokens::Letter, static_cast<char>(Data));
 					ClearAndBreak();
 					return;
 				}
@@ -962,7 +557,7 @@ namespace ino {
 			{
 				Data = "";
 				while (CanRead())
-					Data += String(Read());
+					Data += String(InternalRead());
 			}
 		}
 		template <typename T>
@@ -987,11 +582,11 @@ namespace ino {
 			{
 				int C = 0;
 				for (; CanRead() && C < CString.StringSize - 1; C++)
-					Data[C] = Read();
+					Data[C] = InternalRead();
 				Data[C] = '\0';
 				if (C < CString.StringSize - 1)
 				{
-					SetFailFlag(Fails::WrongCString);
+					ParseFailed(Fails::WrongCString, ParseError::Operators::CString, ParseError::Tokens::MoreData);
 					ClearAndBreak();
 					return;
 				}
@@ -1001,7 +596,7 @@ namespace ino {
 				int C = 0;
 				for (; CanRead() && C < CString.StringSize - 1; C++)
 				{
-					char Input = Read();
+					char Input = InternalRead();
 					if (Input == '\0')
 						break;
 					Data[C] = Input;
@@ -1010,7 +605,7 @@ namespace ino {
 			}
 			if (CanRead())
 			{
-				SetFailFlag(Fails::WrongCString);
+				ParseFailed(Fails::WrongCString, ParseError::Operators::CString, ParseError::Tokens::TransferEnd);
 				ClearAndBreak();
 				return;
 			}
@@ -1026,7 +621,7 @@ namespace ino {
 				Data[C] = '\0';
 				if (C < CString.StringSize - 1)
 				{
-					SetFailFlag(Fails::WrongCString);
+					ParseFailed(Fails::WrongCString, ParseError::Operators::CString, ParseError::Tokens::MoreData);
 					ClearAndBreak();
 					return;
 				}
@@ -1044,7 +639,7 @@ namespace ino {
 			}
 			if (CanRead())
 			{
-				SetFailFlag(Fails::WrongCString);
+				ParseFailed(Fails::WrongCString, ParseError::Operators::CString, ParseError::Tokens::TransferEnd);
 				ClearAndBreak();
 				return;
 			}
@@ -1062,6 +657,7 @@ namespace ino {
 	 */
 	template <typename T, typename std::enable_if<IsSigned<typename ReduceTypeExceptConst<T>::type>::value && std::is_integral<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const BaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1071,6 +667,7 @@ namespace ino {
 	
 	template <typename T, typename std::enable_if<IsUnsigned<typename ReduceTypeExceptConst<T>::type>::value && std::is_integral<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const BaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1082,9 +679,10 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_same<char, typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const CaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultChar(Data.Var, Data.Val);
 		if (CanRead()) {
-			SetFailFlag(Fails::NotAChar);
+			ParseFailed(Fails::NotAChar, ParseError::Operators::Char, ParseError::Tokens::TransferEnd);
 			ClearAndBreak();
 		}
 		FinishTransfer();
@@ -1095,6 +693,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_same<String, typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const CaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultString(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1106,6 +705,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_same<bool, typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const BoolFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultBool(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1117,6 +717,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const DecimalpointFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1128,6 +729,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const PrecisionFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1139,6 +741,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const SpecialnumberFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1149,6 +752,7 @@ namespace ino {
 		
 	template <typename T, typename std::enable_if<(std::is_same<char*, typename ReduceTypeExceptConst<T>::type>::value || IsElementTypeConsiderConst<char, T>::value) && std::is_lvalue_reference<T>::value, int>::type>
 	InStream& InStream::operator>>(const CStringFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -1160,6 +764,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<IsSigned<typename ReduceTypeExceptConst<T>::type>::value && std::is_integral<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<BaseFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data.Var, Data.template Get<BaseFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -1169,6 +774,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<IsUnsigned<typename ReduceTypeExceptConst<T>::type>::value && std::is_integral<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<BaseFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data.Var, Data.template Get<BaseFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -1178,6 +784,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<PrecisionFormats>());
 		FinishTransfer();
 		return *this;
@@ -1187,6 +794,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -1196,6 +804,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<PrecisionFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -1205,6 +814,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 3 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<PrecisionFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -1214,6 +824,7 @@ namespace ino {
 		
 	template <typename T, typename... FmtTs, typename std::enable_if<(std::is_same<char*, typename ReduceTypeExceptConst<T>::type>::value || IsElementTypeConsiderConst<char, T>::value) && std::is_lvalue_reference<T>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<CStringFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	InStream& InStream::operator>>(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data.Var, Data.template Get<CStringFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -0,0 +1,432 @@
+#include "InoCore.h"
+#include "JsonReader.h"
+
+namespace ino {
+
+	/**
+	 * @brief Advances the reader to the next token of the document.
+	 * @details
+	 * 	If the previous token was a key, string or number that has not been read with ReadString(), ReadKey() or ReadNumber(), it is skipped.
+	 * 	Whitespace, colons and commas are consumed silently and are checked against the JSON grammar.
+	 * 	Once the top-level value is complete, ino::JsonReader::Token::End is returned without reading any further from the stream. Call Reset() to read the next document.
+	 * 	Any syntax error, a nesting deeper than `INO_JSONREADER_MAXDEPTH` or a stream without data leads to ino::JsonReader::Token::Error, which is kept until Reset() is called.
+	 */
+	JsonReader::Token JsonReader::Next()
+	{
+		if (Current == Token::Error)
+			return Current;
+		if (Pending)
+		{
+			if (Current == Token::Number)
+				ConsumeNumber();
+			else
+				ConsumeString(nullptr, 0);
+			Pending = false;
+		}
+		if (Expected == Expect::Done)
+			return Current = Token::End;
+
+		char Character;
+		while (true)
+		{
+			if (!SkipWhitespace(Character))
+				return Current = Token::Error;
+
+			if (Expected == Expect::Colon)
+			{
+				if (Character != ':')
+					return Current = Token::Error;
+				Stream.Read();
+				Expected = Expect::Value;
+				continue;
+			}
+			else if (Expected == Expect::CommaOrEnd)
+			{
+				if (Character == ',')
+				{
+					Stream.Read();
+					Expected = IsObject() ? Expect::Key : Expect::Value;
+					continue;
+				}
+				else if (Character == (IsObject() ? '}' : ']'))
+				{
+					Stream.Read();
+					Token Closed = IsObject() ? Token::EndObject : Token::EndArray;
+					Depth--;
+					FinishValue();
+					return Current = Closed;
+				}
+				return Current = Token::Error;
+			}
+			else if (Expected == Expect::Key || Expected == Expect::KeyOrEnd)
+			{
+				if (Expected == Expect::KeyOrEnd && Character == '}')
+				{
+					Stream.Read();
+					Depth--;
+					FinishValue();
+					return Current = Token::EndObject;
+				}
+				if (Character != '"')
+					return Current = Token::Error;
+				Stream.Read();
+				Pending = true;
+				Expected = Expect::Colon;
+				return Current = Token::Key;
+			}
+			else if (Expected == Expect::ValueOrEnd && Character == ']')
+			{
+				Stream.Read();
+				Depth--;
+				FinishValue();
+				return Current = Token::EndArray;
+			}
+			break;
+		}
+
+		if (Character == '{' || Character == '[')
+		{
+			Stream.Read();
+			if (!Push(Character == '{'))
+				return Current = Token::Error;
+			Expected = Character == '{' ? Expect::KeyOrEnd : Expect::ValueOrEnd;
+			return Current = Character == '{' ? Token::BeginObject : Token::BeginArray;
+		}
+		else if (Character == '"')
+		{
+			Stream.Read();
+			Pending = true;
+			FinishValue();
+			return Current = Token::String;
+		}
+		else if (Character == '-' || (Character >= '0' && Character <= '9'))
+		{
+			Pending = true;
+			FinishValue();
+			return Current = Token::Number;
+		}
+		else if (Character == 't' && ReadLiteral("true"))
+		{
+			FinishValue();
+			return Current = Token::True;
+		}
+		else if (Character == 'f' && ReadLiteral("false"))
+		{
+			FinishValue();
+			return Current = Token::False;
+		}
+		else if (Character == 'n' && ReadLiteral("null"))
+		{
+			FinishValue();
+			return Current = Token::Null;
+		}
+		return Current = Token::Error;
+	}
+
+	/**
+	 * @brief Reads the current key or string token into a c-string. Escape sequences are decoded, `\u` sequences are stored as UTF-8.
+	 * @return Returns `false` if the string did not fit into the buffer (it is truncated and terminated anyway) or if the current token is not a key or string.
+	 */
+	bool JsonReader::ReadString(char* Buffer, unsigned int Size)
+	{
+		if (!Pending || (Current != Token::Key && Current != Token::String))
+			return Fail();
+		Pending = false;
+		return ConsumeString(Buffer, Size);
+	}
+
+	/**
+	 * @brief Reads the current key or string token into a `String`. Prefer ReadString(char*, unsigned int) or ReadKey() where RAM is scarce.
+	 */
+	bool JsonReader::ReadString(String& Data)
+	{
+		if (!Pending || (Current != Token::Key && Current != Token::String))
+			return Fail();
+		Pending = false;
+
+		Data = "";
+		char Unit[3];
+		uint8_t Length;
+		while ((Length = ReadStringUnit(Unit)) != 0)
+		{
+			if (Length == 0xFF)
+				return Fail();
+			for (uint8_t C = 0; C < Length; C++)
+				Data += Unit[C];
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Skips the current value.
+	 * @details
+	 * 	- On a key, the key and its value are skipped
+	 * 	- On ino::JsonReader::Token::BeginObject or ino::JsonReader::Token::BeginArray the whole container is skipped, so that the next call to Next() returns the token after it
+	 * 	- On a string or number that has not been read yet, it is consumed
+	 */
+	void JsonReader::Skip()
+	{
+		if (Current == Token::Key)
+		{
+			if (Next() != Token::Error)
+				Skip();
+		}
+		else if (Pending)
+		{
+			if (Current == Token::Number)
+				ConsumeNumber();
+			else
+				ConsumeString(nullptr, 0);
+			Pending = false;
+		}
+		else if (Current == Token::BeginObject || Current == Token::BeginArray)
+		{
+			uint8_t Target = Depth - 1;
+			while (Depth > Target && Next() != Token::Error);
+		}
+	}
+
+	bool JsonReader::Push(bool Object)
+	{
+		if (Depth >= INO_JSONREADER_MAXDEPTH)
+			return false;
+		if (Object)
+			Nesting[Depth / 8] |= (1 << (Depth % 8));
+		else
+			Nesting[Depth / 8] &= ~(1 << (Depth % 8));
+		Depth++;
+		return true;
+	}
+
+	void JsonReader::FinishValue()
+	{
+		Expected = Depth ? Expect::CommaOrEnd : Expect::Done;
+	}
+
+	bool JsonReader::WaitRead(char& Character)
+	{
+		if (!Stream.WaitForData())
+			return false;
+		Character = Stream.Read();
+		return true;
+	}
+
+	bool JsonReader::WaitPeek(char& Character)
+	{
+		if (!Stream.WaitForData())
+			return false;
+		Character = Stream.Peek();
+		return true;
+	}
+
+	bool JsonReader::SkipWhitespace(char& Character)
+	{
+		while (WaitPeek(Character))
+		{
+			if (Character != ' ' && Character != '\t' && Character != '\n' && Character != '\r')
+				return true;
+			Stream.Read();
+		}
+		return false;
+	}
+
+	bool JsonReader::ReadLiteral(const char* Literal)
+	{
+		char Character;
+		for (int C = 0; Literal[C] != '\0'; C++)
+		{
+			if (!WaitRead(Character) || Character != Literal[C])
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Reads one (possibly escaped) character of a string token.
+	 * @return Returns the number of bytes stored in `Unit` (up to 3 for `\u` sequences), `0` at the closing quote and `0xFF` on a malformed string.
+	 */
+	uint8_t JsonReader::ReadStringUnit(char* Unit)
+	{
+		char Character;
+		if (!WaitRead(Character))
+			return 0xFF;
+		if (Character == '"')
+			return 0;
+		if (Character != '\\')
+		{
+			Unit[0] = Character;
+			return 1;
+		}
+
+		if (!WaitRead(Character))
+			return 0xFF;
+		switch (Character)
+		{
+		case '"': case '\\': case '/': Unit[0] = Character; return 1;
+		case 'b': Unit[0] = '\b'; return 1;
+		case 'f': Unit[0] = '\f'; return 1;
+		case 'n': Unit[0] = '\n'; return 1;
+		case 'r': Unit[0] = '\r'; return 1;
+		case 't': Unit[0] = '\t'; return 1;
+		case 'u':
+		{
+			uint16_t CodePoint = 0;
+			for (uint8_t C = 0; C < 4; C++)
+			{
+				if (!WaitRead(Character))
+					return 0xFF;
+				if (Character >= '0' && Character <= '9')
+					CodePoint = (CodePoint << 4) | (Character - 48);
+				else if (Character >= 'A' && Character <= 'F')
+					CodePoint = (CodePoint << 4) | (Character - 55);
+				else if (Character >= 'a' && Character <= 'f')
+					CodePoint = (CodePoint << 4) | (Character - 87);
+				else
+					return 0xFF;
+			}
+			if (CodePoint < 0x80)
+			{
+				Unit[0] = CodePoint;
+				return 1;
+			}
+			else if (CodePoint < 0x800)
+			{
+				Unit[0] = 0xC0 | (CodePoint >> 6);
+				Unit[1] = 0x80 | (CodePoint & 0x3F);
+				return 2;
+			}
+			Unit[0] = 0xE0 | (CodePoint >> 12);
+			Unit[1] = 0x80 | ((CodePoint >> 6) & 0x3F);
+			Unit[2] = 0x80 | (CodePoint & 0x3F);
+			return 3;
+		}
+		default:
+			return 0xFF;
+		}
+	}
+
+	bool JsonReader::ConsumeString(char* Buffer, unsigned int Size)
+	{
+		char Unit[3];
+		uint8_t Length;
+		unsigned int Pos = 0;
+		bool Fits = true;
+		while ((Length = ReadStringUnit(Unit)) != 0)
+		{
+			if (Length == 0xFF)
+				return Fail();
+			for (uint8_t C = 0; C < Length; C++)
+			{
+				if (Pos + 1 < Size)
+					Buffer[Pos++] = Unit[C];
+				else
+					Fits = false;
+			}
+		}
+		if (Size)
+			Buffer[Pos] = '\0';
+		return Fits;
+	}
+
+	void JsonReader::ConsumeNumber()
+	{
+		char Buffer[INO_JSONREADER_NUMBERSIZE];
+		uint8_t Exponent;
+		ScanNumber(Buffer, Exponent);
+	}
+
+	/**
+	 * @brief Collects the characters of the current number token into `Buffer` (at most `INO_JSONREADER_NUMBERSIZE - 1`).
+	 * @details The number ends at the first character that cannot be part of it. Like every other token it waits for data, so a top-level number only ends at another character or when the stream has no more data (ex. after its timeout).
+	 * @param Exponent Set to the index following the exponent character `e` or `E`, `0` if the number has no exponent.
+	 * @return Returns the number of characters collected.
+	 */
+	uint8_t JsonReader::ScanNumber(char* Buffer, uint8_t& Exponent)
+	{
+		Exponent = 0;
+		if (!Pending || Current != Token::Number)
+		{
+			Fail();
+			return 0;
+		}
+		Pending = false;
+
+		uint8_t Length = 0;
+		char Character;
+		while (true)
+		{
+			if (!WaitPeek(Character))
+				break;
+			if (Character == 'e' || Character == 'E')
+			{
+				if (Exponent)
+					break;
+				Exponent = Length + 1;
+			}
+			else if (!((Character >= '0' && Character <= '9') || Character == '-' || Character == '+' || Character == '.'))
+				break;
+			if (Length == INO_JSONREADER_NUMBERSIZE - 1)
+			{
+				Fail();
+				return 0;
+			}
+			Buffer[Length++] = Stream.Read();
+		}
+		Buffer[Length] = '\0';
+		if (Length == 0 || Exponent == Length)
+			Fail();
+		return Length;
+	}
+
+	int JsonReader::MatchKey(const char* const* Keys, size_t Count, uint8_t* Alive)
+	{
+		if (!Pending || (Current != Token::Key && Current != Token::String))
+		{
+			Fail();
+			return -1;
+		}
+		Pending = false;
+
+		for (size_t K = 0; K < (Count + 7) / 8; K++)
+			Alive[K] = 0xFF;
+
+		char Unit[3];
+		uint8_t Length;
+		size_t Pos = 0;
+		while ((Length = ReadStringUnit(Unit)) != 0)
+		{
+			if (Length == 0xFF)
+			{
+				Fail();
+				return -1;
+			}
+			for (uint8_t C = 0; C < Length; C++, Pos++)
+			{
+				for (size_t K = 0; K < Count; K++)
+				{
+					// A key ends at its terminator, even if the unit is `\u0000`
+					if ((Alive[K / 8] & (1 << (K % 8))) && (Keys[K][Pos] == '\0' || Keys[K][Pos] != Unit[C]))
+						Alive[K / 8] &= ~(1 << (K % 8));
+				}
+			}
+		}
+
+		for (size_t K = 0; K < Count; K++)
+		{
+			if ((Alive[K / 8] & (1 << (K % 8))) && Keys[K][Pos] == '\0')
+				return K;
+		}
+		return -1;
+	}
+
+	bool JsonReader::IsIntegralNumber(const char* Buffer, uint8_t Length)
+	{
+		for (uint8_t C = 0; C < Length; C++)
+		{
+			if (Buffer[C] == '.')
+				return false;
+		}
+		return true;
+	}
+
+}
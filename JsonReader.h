@@ -0,0 +1,209 @@
+#pragma once
+#ifndef INO_JSONREADER_INCLUDED
+#define INO_JSONREADER_INCLUDED
+
+#include "InoCore.h"
+#include "InStream.h"
+#include "SpanInStream.h"
+
+#ifndef INO_JSONREADER_MAXDEPTH
+#define INO_JSONREADER_MAXDEPTH 16
+#endif
+
+#ifndef INO_JSONREADER_NUMBERSIZE
+#define INO_JSONREADER_NUMBERSIZE 32
+#endif
+
+namespace ino {
+
+	class JsonReader
+	{
+	public:
+		enum class Token : uint8_t {
+			None,
+			BeginObject,
+			EndObject,
+			BeginArray,
+			EndArray,
+			Key,
+			String,
+			Number,
+			True,
+			False,
+			Null,
+			End,
+			Error,
+		};
+
+	private:
+		enum class Expect : uint8_t { Value, ValueOrEnd, Key, KeyOrEnd, Colon, CommaOrEnd, Done };
+
+		InStream& Stream;
+		uint8_t Nesting[(INO_JSONREADER_MAXDEPTH + 7) / 8];
+		uint8_t Depth = 0;
+		Expect Expected = Expect::Value;
+		Token Current = Token::None;
+		bool Pending = false;
+
+	public:
+		JsonReader(InStream& Stream) : Stream(Stream) {}
+
+		Token Next();
+		inline Token GetToken() const { return Current; }
+		inline uint8_t GetDepth() const { return Depth; }
+		inline bool Failed() const { return Current == Token::Error; }
+		inline void Reset() { Depth = 0; Expected = Expect::Value; Current = Token::None; Pending = false; }
+
+		bool ReadString(char* Buffer, unsigned int Size);
+		bool ReadString(String& Data);
+		void Skip();
+
+		/**
+		 * @brief Matches the current key (or string value) against a table of known keys without buffering it.
+		 * @return Returns the index of the matching key or `-1` if the key is not part of the table.
+		 */
+		template <size_t N>
+		inline int ReadKey(const char* const (&Keys)[N])
+		{
+			uint8_t Alive[(N + 7) / 8];
+			return MatchKey(Keys, N, Alive);
+		}
+
+		/**
+		 * @brief Reads the current number token through the integral and floating-point input operators of ino::InStream.
+		 * @details Integrals also accept an exponent, as long as the value is integral (ex. `1e3` or `2.5e1`, but not `25e-1`).
+		 * @return Returns `false` if the number does not fit the type `T` (ex. a fraction read into an integral).
+		 */
+		template <typename T, typename std::enable_if<std::is_integral<T>::value || std::is_floating_point<T>::value, int>::type = 0>
+		bool ReadNumber(T& Data)
+		{
+			char Buffer[INO_JSONREADER_NUMBERSIZE];
+			uint8_t Exponent = 0;
+			uint8_t Length = ScanNumber(Buffer, Exponent);
+			if (Current == Token::Error)
+				return false;
+			if (Exponent)
+				return ParseExponent(Data, Buffer, Length, Exponent);
+			if (!IsIntegralNumber(Buffer, Length))
+			{
+				if (!std::is_floating_point<T>::value)
+					return Fail();
+				return ParseFloat(Data, Buffer, Length, Exponent);
+			}
+
+			SpanInStream Span(Buffer, Length);
+			Span >> Data;
+			if (Span.Failed())
+				return Fail();
+			return true;
+		}
+
+	private:
+		inline bool IsObject() const { return Depth && (Nesting[(Depth - 1) / 8] & (1 << ((Depth - 1) % 8))); }
+		inline bool Fail() { Current = Token::Error; Pending = false; return false; }
+
+		bool Push(bool Object);
+		void FinishValue();
+		bool WaitRead(char& Character);
+		bool WaitPeek(char& Character);
+		bool SkipWhitespace(char& Character);
+		bool ReadLiteral(const char* Literal);
+		uint8_t ReadStringUnit(char* Unit);
+		bool ConsumeString(char* Buffer, unsigned int Size);
+		void ConsumeNumber();
+		uint8_t ScanNumber(char* Buffer, uint8_t& Exponent);
+		int MatchKey(const char* const* Keys, size_t Count, uint8_t* Alive);
+
+		static bool IsIntegralNumber(const char* Buffer, uint8_t Length);
+
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<bool, T>::value, int>::type = 0>
+		bool ParseExponent(T& Data, const char* Buffer, uint8_t Length, uint8_t Exponent)
+		{
+			int Power10 = 0;
+			if (!ParseExponentPart(Power10, Buffer, Length, Exponent))
+				return Fail();
+
+			// Collect the digits of the mantissa, each decimal lowers the power
+			using U = typename std::make_unsigned<T>::type;
+			const U Max = std::is_signed<T>::value ? static_cast<U>(~U(0)) >> 1 : static_cast<U>(~U(0));
+			bool Negative = Buffer[0] == '-';
+			bool Decimals = false;
+			U Value = 0;
+			for (uint8_t C = Negative; C < Exponent - 1; C++)
+			{
+				if (Buffer[C] == '.' && !Decimals)
+				{
+					Decimals = true;
+					continue;
+				}
+				if (Buffer[C] < '0' || Buffer[C] > '9')
+					return Fail();
+				uint8_t Digit = Buffer[C] - '0';
+				if (Value > (Max - Digit) / 10)
+					return Fail();
+				Value = Value * 10 + Digit;
+				if (Decimals)
+					Power10--;
+			}
+
+			for (; Value && Power10 > 0; Power10--)
+			{
+				if (Value > Max / 10)
+					return Fail();
+				Value *= 10;
+			}
+			for (; Value && Power10 < 0; Power10++)
+			{
+				if (Value % 10)
+					return Fail();
+				Value /= 10;
+			}
+			if (Negative && Value && !std::is_signed<T>::value)
+				return Fail();
+			Data = Negative ? static_cast<T>(-static_cast<T>(Value)) : static_cast<T>(Value);
+			return true;
+		}
+
+		template <typename T, typename std::enable_if<!std::is_integral<T>::value || std::is_same<bool, T>::value, int>::type = 0>
+		bool ParseExponent(T& Data, const char* Buffer, uint8_t Length, uint8_t Exponent)
+		{
+			if (!std::is_floating_point<T>::value)
+				return Fail();
+			return ParseFloat(Data, Buffer, Length, Exponent);
+		}
+
+		// Reads the exponent after the index `Exponent` (see ScanNumber()), a leading `+` is allowed
+		static bool ParseExponentPart(int& Power10, const char* Buffer, uint8_t Length, uint8_t Exponent)
+		{
+			if (Buffer[Exponent] == '+')
+				Exponent++;
+			SpanInStream ExponentSpan(Buffer + Exponent, Length - Exponent);
+			ExponentSpan >> Power10;
+			return !ExponentSpan.Failed();
+		}
+
+		template <typename T>
+		bool ParseFloat(T& Data, const char* Buffer, uint8_t Length, uint8_t Exponent)
+		{
+			SpanInStream Mantissa(Buffer, Exponent ? Exponent - 1 : Length);
+			Mantissa >> Data;
+			if (Mantissa.Failed())
+				return Fail();
+			if (Exponent)
+			{
+				int Power10 = 0;
+				if (!ParseExponentPart(Power10, Buffer, Length, Exponent))
+					return Fail();
+				if (Power10 < 0)
+					Data /= Power(static_cast<T>(10), -Power10);
+				else
+					Data *= Power(static_cast<T>(10), Power10);
+			}
+			return true;
+		}
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,240 @@
+#pragma once
+#ifndef INO_LOGRING_INCLUDED
+#define INO_LOGRING_INCLUDED
+
+#include "InoCore.h"
+#include "OutStream.h"
+#include "SpanOutStream.h"
+#include "SpscRing.h"
+
+#include <new>
+
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#elif defined(INO_HOST)
+#include <atomic>
+#endif
+
+namespace ino {
+
+#ifdef __AVR__
+	/**
+	 * @brief Disables interrupts for its lifetime and restores the previous interrupt state afterwards.
+	 */
+	class CriticalSection
+	{
+	private:
+		uint8_t Sreg;
+
+	public:
+		inline CriticalSection() : Sreg(SREG) { cli(); }
+		inline ~CriticalSection() { SREG = Sreg; }
+	};
+#elif defined(INO_HOST)
+	/**
+	 * @brief Spins on a flag for its lifetime. On host there are no interrupts to disable, but several threads may produce. The flag belongs to the guarded object, so independent objects do not wait for each other.
+	 */
+	class CriticalSection
+	{
+	private:
+		std::atomic_flag& Flag;
+
+	public:
+		inline explicit CriticalSection(std::atomic_flag& Flag) : Flag(Flag) { while (Flag.test_and_set(std::memory_order_acquire)); }
+		inline ~CriticalSection() { Flag.clear(std::memory_order_release); }
+	};
+#elif defined(__arm__) && (defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_BASE__) || defined(__ARM_ARCH_8M_MAIN__))
+	/**
+	 * @brief Disables interrupts for its lifetime and restores the previous PRIMASK afterwards (Cortex-M).
+	 */
+	class CriticalSection
+	{
+	private:
+		uint32_t Primask;
+
+	public:
+		inline CriticalSection() { asm volatile("mrs %0, primask" : "=r"(Primask)); asm volatile("cpsid i" ::: "memory"); }
+		inline ~CriticalSection() { asm volatile("msr primask, %0" :: "r"(Primask) : "memory"); }
+	};
+#elif defined(ESP8266)
+	/**
+	 * @brief Raises the interrupt level for its lifetime and restores the previous level afterwards.
+	 */
+	class CriticalSection
+	{
+	private:
+		uint32_t Level;
+
+	public:
+		inline CriticalSection() : Level(xt_rsil(15)) {}
+		inline ~CriticalSection() { xt_wsr_ps(Level); }
+	};
+#else
+	/**
+	 * @brief Disables interrupts for its lifetime. The previous state cannot be read on this platform, so interrupts are enabled afterwards. It must not be nested: on such platforms do not use ino::LogRing where interrupts are disabled already, ex. after `noInterrupts()` or in interrupt service routines.
+	 */
+	class CriticalSection
+	{
+	public:
+		inline CriticalSection() { noInterrupts(); }
+		inline ~CriticalSection() { interrupts(); }
+	};
+#endif
+
+	/**
+	 * @brief Space reserved in an ino::LogRing. The record is an ino::SpanOutStream over the reserved bytes, so the usual output operators format directly into the ring.
+	 * @details If the reservation failed (the ring was full), the record has no space and everything written to it is dropped.
+	 */
+	class LogRecord : public SpanOutStream
+	{
+	private:
+		template <size_t N>
+		friend class LogRing;
+
+		void* Header;
+
+	public:
+		LogRecord(void* Header, char* Data, size_t Size) : SpanOutStream(Data, Size), Header(Header) {}
+
+		inline bool Reserved() const { return Header != nullptr; }
+	};
+
+	/**
+	 * @brief Ring of variable-length log records that can be written from interrupt service routines without blocking.
+	 * @details
+	 * 	Producers (any interrupt or `loop()`) reserve space with a single short critical section, format into it and publish it with Commit().
+	 * 	The consumer (`loop()`) calls Drain(), which writes the committed records in the order they were reserved. A record that is reserved but not committed yet holds back the records after it.
+	 * 	When the ring is full, Reserve() fails instead of waiting and the record is counted by Dropped().
+	 * 	The critical section restores the previous interrupt state on AVR, Cortex-M and ESP8266, on other platforms it always enables interrupts at its end (see ino::CriticalSection).
+	 *
+	 * 	Ex. (in an interrupt service routine)
+	 * 	`ino::LogRecord Record = Log.Reserve(24); Record << micros() << " edge" << ino::endl; Log.Commit(Record);`
+	 */
+	template <size_t N>
+	class LogRing
+	{
+		static_assert(N <= 0xFFFF, "ino::LogRing size must fit into 16 bit");
+
+	private:
+		struct Header
+		{
+			uint16_t Size;
+			uint16_t Length;
+			RingIndex<uint8_t> Committed;
+		};
+
+		static constexpr uint16_t HeaderSize = (sizeof(Header) + alignof(Header) - 1) / alignof(Header) * alignof(Header);
+		static_assert(N % alignof(Header) == 0, "ino::LogRing size must be a multiple of the header alignment");
+
+		alignas(Header) char Buffer[N];
+		uint16_t Head = 0;
+		uint16_t Tail = 0;
+		uint16_t Used = 0;
+		uint16_t DroppedRecords = 0;
+#ifdef INO_HOST
+		mutable std::atomic_flag Busy = ATOMIC_FLAG_INIT; // Flag of the critical section, every ring has its own
+#endif
+
+		// Critical section of this ring
+		struct Guard : CriticalSection
+		{
+#ifdef INO_HOST
+			inline explicit Guard(const LogRing& Ring) : CriticalSection(Ring.Busy) {}
+#else
+			inline explicit Guard(const LogRing&) {}
+#endif
+		};
+
+		inline Header* HeaderAt(uint16_t Pos) { return reinterpret_cast<Header*>(Buffer + Pos); }
+
+	public:
+		/**
+		 * @brief Reserves space for a record of up to `Size` characters.
+		 */
+		LogRecord Reserve(uint16_t Size)
+		{
+			uint16_t Total = (HeaderSize + Size + alignof(Header) - 1) / alignof(Header) * alignof(Header);
+			Guard Lock(*this);
+			uint16_t Pos = Head;
+			uint16_t Padding = 0;
+			if (Total > N - Head)
+			{
+				Padding = N - Head;
+				Pos = 0;
+			}
+			if (Total > N || Padding + Total > N - Used)
+			{
+				DroppedRecords++;
+				return LogRecord(nullptr, nullptr, 0);
+			}
+			if (Padding >= HeaderSize)
+			{
+				Header* Skip = new (HeaderAt(Head)) Header{ Padding, 0, {} };
+				Skip->Committed.Store(1);
+			}
+			Header* Reserved = new (HeaderAt(Pos)) Header{ Total, 0, {} };
+			Head = Pos + Total == N ? 0 : Pos + Total;
+			Used += Padding + Total;
+			return LogRecord(Reserved, Buffer + Pos + HeaderSize, Total - HeaderSize);
+		}
+
+		/**
+		 * @brief Publishes a reserved record with the characters written to it so far.
+		 */
+		void Commit(LogRecord& Record)
+		{
+			if (!Record.Reserved())
+				return;
+			Header* Reserved = static_cast<Header*>(Record.Header);
+			Reserved->Length = Record.GetLength();
+			Reserved->Committed.Store(1);
+			Record.Header = nullptr;
+		}
+
+		/**
+		 * @brief Writes the committed records in order to `Stream`, up to the first record that is not committed yet. Must only be called from a single context.
+		 * @return Returns the number of records written.
+		 */
+		size_t Drain(OutStream& Stream)
+		{
+			size_t Count = 0;
+			while (true)
+			{
+				{
+					Guard Lock(*this);
+					if (Used == 0)
+						break;
+					if (N - Tail < HeaderSize)
+					{
+						Used -= N - Tail;
+						Tail = 0;
+						continue;
+					}
+				}
+
+				Header* Current = HeaderAt(Tail);
+				if (!Current->Committed.Load())
+					break;
+				if (Current->Length)
+				{
+					Stream.Put(Buffer + Tail + HeaderSize, Current->Length);
+					Count++;
+				}
+				uint16_t Size = Current->Size;
+				Current->Committed.Store(0);
+
+				Guard Lock(*this);
+				Tail = Tail + Size == N ? 0 : Tail + Size;
+				Used -= Size;
+			}
+			return Count;
+		}
+
+		inline uint16_t Dropped() const { Guard Lock(*this); return DroppedRecords; }
+		inline bool Empty() const { Guard Lock(*this); return Used == 0; }
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,49 @@
+#include "InoCore.h"
+#include "MappedFileInStream.h"
+
+#ifdef INO_HOST
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ino {
+
+	MappedFileInStream::Mapping MappedFileInStream::Map(const char* Path)
+	{
+		Mapping Result{ nullptr, 0, false };
+		int Fd = ::open(Path, O_RDONLY | O_CLOEXEC);
+		if (Fd < 0)
+			return Result;
+
+		struct stat Info;
+		if (fstat(Fd, &Info) == 0 && S_ISREG(Info.st_mode))
+		{
+			Result.Opened = true;
+			if (Info.st_size > 0)
+			{
+				void* Address = mmap(nullptr, Info.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+				if (Address != MAP_FAILED)
+				{
+					madvise(Address, Info.st_size, MADV_SEQUENTIAL);
+					Result.Address = Address;
+					Result.Length = Info.st_size;
+				}
+				else
+					Result.Opened = false;
+			}
+		}
+		::close(Fd); // The mapping stays valid without the file descriptor
+		return Result;
+	}
+
+	MappedFileInStream::~MappedFileInStream()
+	{
+		if (File.Address)
+			munmap(File.Address, File.Length);
+	}
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+#ifndef INO_MAPPEDFILEINSTREAM_INCLUDED
+#define INO_MAPPEDFILEINSTREAM_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "SpanInStream.h"
+
+namespace ino {
+
+	/**
+	 * @brief Input stream over a memory-mapped file (host only).
+	 * @details
+	 * 	The whole file is mapped read-only with `mmap()` and marked for sequential access with `madvise()`, so parsing never copies and never calls into the kernel per character.
+	 * 	Besides Peek() and Read() the remaining file is available as a contiguous span (PeekSpan(), SpanSize()), which can be scanned directly and consumed with Advance().
+	 * 	If the file cannot be opened or mapped, IsOpen() returns false and the stream behaves like an empty stream.
+	 */
+	class MappedFileInStream : public SpanInStream
+	{
+	private:
+		struct Mapping
+		{
+			void* Address;
+			size_t Length;
+			bool Opened;
+		};
+
+		Mapping File;
+
+		static Mapping Map(const char* Path);
+		MappedFileInStream(Mapping File) : SpanInStream(static_cast<const char*>(File.Address), File.Length), File(File) {}
+
+	public:
+		MappedFileInStream(const char* Path) : MappedFileInStream(Map(Path)) {}
+		~MappedFileInStream();
+
+		MappedFileInStream(const MappedFileInStream&) = delete;
+		MappedFileInStream& operator=(const MappedFileInStream&) = delete;
+
+		inline bool IsOpen() const { return File.Opened; }
+		inline size_t GetFileSize() const { return File.Length; }
+		inline size_t GetPosition() const { return File.Length - SpanSize(); }
+
+	};
+
+}
+
+#endif
+
+#endif
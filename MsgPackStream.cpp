@@ -0,0 +1,667 @@
+#include "InoCore.h"
+#include "MsgPackStream.h"
+
+#include <string.h>
+
+namespace ino {
+
+	namespace {
+
+		inline void StoreBigEndian(char* Buffer, uint32_t Data, uint8_t Bytes)
+		{
+			for (uint8_t C = Bytes; C > 0; C--)
+			{
+				Buffer[C - 1] = static_cast<char>(Data & 0xFF);
+				Data >>= 8;
+			}
+		}
+
+		float DoubleBitsToFloat(uint32_t High, uint32_t Low)
+		{
+			bool Negative = High & 0x80000000UL;
+			int16_t Exponent = (High >> 20) & 0x7FF;
+			uint32_t Mantissa = ((High & 0xFFFFFUL) << 3) | (Low >> 29); // upper 23 of the 52 mantissa bits
+
+			float Value;
+			if (Exponent == 0x7FF)
+				Value = (Mantissa || (Low & 0x1FFFFFFFUL)) ? NAN : INFINITY;
+			else if (Exponent == 0)
+				Value = 0;
+			else
+				Value = ldexp(static_cast<float>(Mantissa | 0x800000UL), Exponent - 1023 - 23);
+			return Negative ? -Value : Value;
+		}
+
+	}
+
+	// * ----- MsgPackOut ---------------------------------------------------------------------------------------------------------
+
+	MsgPackOut& MsgPackOut::operator<<(bool Data)
+	{
+		Stream.Put(static_cast<char>(Data ? 0xC3 : 0xC2));
+		return *this;
+	}
+
+	/**
+	 * @brief Output operator for `char`. Like ino::OutStream a `char` is a character, so it is encoded as string of length 1.
+	 */
+	MsgPackOut& MsgPackOut::operator<<(char Data)
+	{
+		WriteString(&Data, 1);
+		return *this;
+	}
+
+	MsgPackOut& MsgPackOut::operator<<(const char* Data)
+	{
+		WriteString(Data, strlen(Data));
+		return *this;
+	}
+
+	MsgPackOut& MsgPackOut::operator<<(const String& Data)
+	{
+		WriteString(Data.c_str(), Data.length());
+		return *this;
+	}
+
+	MsgPackOut& MsgPackOut::Nil()
+	{
+		Stream.Put(static_cast<char>(0xC0));
+		return *this;
+	}
+
+	/**
+	 * @brief Starts an array of `Size` elements. The elements are the next `Size` values written.
+	 */
+	MsgPackOut& MsgPackOut::BeginArray(uint32_t Size)
+	{
+		if (Size < 16)
+			Stream.Put(static_cast<char>(0x90 | Size));
+		else if (Size <= 0xFFFF)
+			WriteBigEndian(0xDC, Size, 2);
+		else
+			WriteBigEndian(0xDD, Size, 4);
+		return *this;
+	}
+
+	/**
+	 * @brief Starts a map of `Size` key-value pairs. The pairs are the next `2 * Size` values written (key first).
+	 */
+	MsgPackOut& MsgPackOut::BeginMap(uint32_t Size)
+	{
+		if (Size < 16)
+			Stream.Put(static_cast<char>(0x80 | Size));
+		else if (Size <= 0xFFFF)
+			WriteBigEndian(0xDE, Size, 2);
+		else
+			WriteBigEndian(0xDF, Size, 4);
+		return *this;
+	}
+
+	MsgPackOut& MsgPackOut::Binary(const void* Data, uint32_t Size)
+	{
+		if (Size <= 0xFF)
+			WriteBigEndian(0xC4, Size, 1);
+		else if (Size <= 0xFFFF)
+			WriteBigEndian(0xC5, Size, 2);
+		else
+			WriteBigEndian(0xC6, Size, 4);
+		Stream.Put(static_cast<const char*>(Data), Size);
+		return *this;
+	}
+
+	void MsgPackOut::WriteInteger(int32_t Data)
+	{
+		if (Data >= 0)
+			WriteInteger(static_cast<uint32_t>(Data));
+		else if (Data >= -32)
+			Stream.Put(static_cast<char>(Data));
+		else if (Data >= -128)
+			WriteBigEndian(0xD0, static_cast<uint32_t>(Data), 1);
+		else if (Data >= -32768)
+			WriteBigEndian(0xD1, static_cast<uint32_t>(Data), 2);
+		else
+			WriteBigEndian(0xD2, static_cast<uint32_t>(Data), 4);
+	}
+
+	void MsgPackOut::WriteInteger(int64_t Data)
+	{
+		if (Data >= -2147483647LL - 1 && Data <= 0xFFFFFFFFLL)
+		{
+			if (Data >= 0)
+				WriteInteger(static_cast<uint32_t>(Data));
+			else
+				WriteInteger(static_cast<int32_t>(Data));
+		}
+		else if (Data >= 0)
+			WriteInteger(static_cast<uint64_t>(Data));
+		else
+			WriteBigEndian(0xD3, static_cast<uint64_t>(Data));
+	}
+
+	void MsgPackOut::WriteInteger(uint32_t Data)
+	{
+		if (Data <= 0x7F)
+			Stream.Put(static_cast<char>(Data));
+		else if (Data <= 0xFF)
+			WriteBigEndian(0xCC, Data, 1);
+		else if (Data <= 0xFFFF)
+			WriteBigEndian(0xCD, Data, 2);
+		else
+			WriteBigEndian(0xCE, Data, 4);
+	}
+
+	void MsgPackOut::WriteInteger(uint64_t Data)
+	{
+		if (Data <= 0xFFFFFFFFULL)
+			WriteInteger(static_cast<uint32_t>(Data));
+		else
+			WriteBigEndian(0xCF, Data);
+	}
+
+	void MsgPackOut::WriteFloat(float Data)
+	{
+		uint32_t Bits;
+		memcpy(&Bits, &Data, sizeof(Bits));
+		WriteBigEndian(0xCA, Bits, 4);
+	}
+
+	/**
+	 * @brief Writes a `double` as float 32 if that does not lose precision (or on platforms where `double` is 32 bit wide), as float 64 otherwise.
+	 */
+	void MsgPackOut::WriteDouble(double Data)
+	{
+		if (sizeof(double) <= sizeof(float) || Data != Data || static_cast<double>(static_cast<float>(Data)) == Data)
+		{
+			WriteFloat(static_cast<float>(Data));
+			return;
+		}
+		uint64_t Bits = 0;
+		memcpy(&Bits, &Data, sizeof(Data));
+		WriteBigEndian(0xCB, Bits);
+	}
+
+	void MsgPackOut::WriteString(const char* Data, uint32_t Length)
+	{
+		WriteHeader(0xA0, 31, 0xD9, Length);
+		Stream.Put(Data, Length);
+	}
+
+	void MsgPackOut::WriteHeader(uint8_t Fix, uint8_t FixMax, uint8_t Type8, uint32_t Length)
+	{
+		if (Length <= FixMax)
+			Stream.Put(static_cast<char>(Fix | Length));
+		else if (Length <= 0xFF)
+			WriteBigEndian(Type8, Length, 1);
+		else if (Length <= 0xFFFF)
+			WriteBigEndian(Type8 + 1, Length, 2);
+		else
+			WriteBigEndian(Type8 + 2, Length, 4);
+	}
+
+	void MsgPackOut::WriteBigEndian(uint8_t Type, uint32_t Data, uint8_t Bytes)
+	{
+		char Buffer[5];
+		Buffer[0] = static_cast<char>(Type);
+		StoreBigEndian(Buffer + 1, Data, Bytes);
+		Stream.Put(Buffer, Bytes + 1);
+	}
+
+	void MsgPackOut::WriteBigEndian(uint8_t Type, uint64_t Data)
+	{
+		char Buffer[9];
+		Buffer[0] = static_cast<char>(Type);
+		StoreBigEndian(Buffer + 1, static_cast<uint32_t>(Data >> 32), 4);
+		StoreBigEndian(Buffer + 5, static_cast<uint32_t>(Data), 4);
+		Stream.Put(Buffer, 9);
+	}
+
+
+	// * ----- MsgPackIn ----------------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Returns the type of the next value without consuming it. If the stream has no data, ino::MsgPackIn::Type::Invalid is returned and the fail flag ino::InStream::Fails::NoData is set.
+	 */
+	MsgPackIn::Type MsgPackIn::PeekType()
+	{
+		if (!Stream.WaitForData())
+		{
+			SetFailFlag(Fails::NoData);
+			return Type::Invalid;
+		}
+		uint8_t Byte = Stream.Peek();
+		if (Byte <= 0x7F || Byte >= 0xE0 || (Byte >= 0xCC && Byte <= 0xD3))
+			return Type::Integer;
+		else if (Byte <= 0x8F || Byte == 0xDE || Byte == 0xDF)
+			return Type::Map;
+		else if (Byte <= 0x9F || Byte == 0xDC || Byte == 0xDD)
+			return Type::Array;
+		else if (Byte <= 0xBF || (Byte >= 0xD9 && Byte <= 0xDB))
+			return Type::String;
+		else if (Byte == 0xC0)
+			return Type::Nil;
+		else if (Byte == 0xC2 || Byte == 0xC3)
+			return Type::Bool;
+		else if (Byte == 0xCA || Byte == 0xCB)
+			return Type::Float;
+		else if (Byte >= 0xC4 && Byte <= 0xC6)
+			return Type::Binary;
+		else if ((Byte >= 0xC7 && Byte <= 0xC9) || (Byte >= 0xD4 && Byte <= 0xD8))
+			return Type::Extension;
+		return Type::Invalid;
+	}
+
+	/**
+	 * @brief Input operator for `bool`. Any other type leads to the fail flag ino::InStream::Fails::NotABool being set, the value is skipped.
+	 */
+	MsgPackIn& MsgPackIn::operator>>(bool& Data)
+	{
+		if (PeekType() == Type::Bool)
+			Data = static_cast<uint8_t>(Stream.Read()) == 0xC3;
+		else if (!Failed(Fails::NoData))
+		{
+			SetFailFlag(Fails::NotABool);
+			Skip();
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Input operator for `char`. Expects a string of length 1, anything else leads to the fail flag ino::InStream::Fails::NotAChar being set.
+	 */
+	MsgPackIn& MsgPackIn::operator>>(char& Data)
+	{
+		uint32_t Length;
+		if (!ReadStringHeader(Length))
+			return *this;
+		if (Length != 1)
+		{
+			SetFailFlag(Fails::NotAChar);
+			SkipBytes(Length);
+			return *this;
+		}
+		uint8_t Byte;
+		if (ReadByte(Byte))
+			Data = Byte;
+		return *this;
+	}
+
+	MsgPackIn& MsgPackIn::operator>>(String& Data)
+	{
+		uint32_t Length;
+		if (!ReadStringHeader(Length))
+			return *this;
+		Data = "";
+		Data.reserve(Length);
+		uint8_t Byte;
+		for (uint32_t C = 0; C < Length && ReadByte(Byte); C++)
+			Data += static_cast<char>(Byte);
+		return *this;
+	}
+
+	bool MsgPackIn::ReadNil()
+	{
+		if (PeekType() != Type::Nil)
+			return false;
+		Stream.Read();
+		return true;
+	}
+
+	/**
+	 * @brief Reads an array header.
+	 * @return Returns the number of elements that follow. If the next value is not an array, the fail flag ino::InStream::Fails::WrongFormat is set, the value is skipped and `0` is returned.
+	 */
+	uint32_t MsgPackIn::ReadArray()
+	{
+		uint32_t Size = 0;
+		ReadContainerHeader(0x90, 0xDC, Size);
+		return Size;
+	}
+
+	/**
+	 * @brief Reads a map header.
+	 * @return Returns the number of key-value pairs that follow. If the next value is not a map, the fail flag ino::InStream::Fails::WrongFormat is set, the value is skipped and `0` is returned.
+	 */
+	uint32_t MsgPackIn::ReadMap()
+	{
+		uint32_t Size = 0;
+		ReadContainerHeader(0x80, 0xDE, Size);
+		return Size;
+	}
+
+	/**
+	 * @brief Reads binary data into `Data`.
+	 * @return Returns the number of bytes stored. Bytes that do not fit into `Size` are skipped and the fail flag ino::InStream::Fails::WrongCString is set.
+	 */
+	uint32_t MsgPackIn::ReadBinary(void* Data, uint32_t Size)
+	{
+		if (PeekType() != Type::Binary)
+		{
+			if (!Failed(Fails::NoData))
+			{
+				SetFailFlag(Fails::WrongFormat);
+				Skip();
+			}
+			return 0;
+		}
+		uint8_t Byte = Stream.Read();
+		uint32_t Length;
+		if (!ReadBigEndian(Length, 1 << (Byte - 0xC4)))
+			return 0;
+
+		uint32_t C = 0;
+		for (; C < Length && C < Size && ReadByte(Byte); C++)
+			static_cast<uint8_t*>(Data)[C] = Byte;
+		if (Length > Size)
+		{
+			SetFailFlag(Fails::WrongCString);
+			SkipBytes(Length - Size);
+		}
+		return C;
+	}
+
+	/**
+	 * @brief Skips the next value, including all elements of arrays and maps. Needs no memory for nesting.
+	 */
+	void MsgPackIn::Skip()
+	{
+		uint32_t Remaining = 1;
+		while (Remaining)
+		{
+			Type Next = PeekType();
+			if (Next == Type::Invalid)
+			{
+				if (!Failed(Fails::NoData))
+				{
+					Stream.Read();
+					SetFailFlag(Fails::WrongFormat);
+				}
+				return;
+			}
+
+			uint8_t Byte = Stream.Read();
+			uint32_t Length = 0;
+			if (Next == Type::Array || Next == Type::Map)
+			{
+				if (Byte <= 0x9F)
+					Length = Byte & 0x0F;
+				else if (!ReadBigEndian(Length, (Byte & 1) ? 4 : 2))
+					return;
+				Remaining += (Next == Type::Map) ? 2 * Length : Length;
+			}
+			else if (Next == Type::String)
+			{
+				if (Byte <= 0xBF)
+					Length = Byte & 0x1F;
+				else if (!ReadBigEndian(Length, 1 << (Byte - 0xD9)))
+					return;
+				SkipBytes(Length);
+			}
+			else if (Next == Type::Binary)
+			{
+				if (!ReadBigEndian(Length, 1 << (Byte - 0xC4)))
+					return;
+				SkipBytes(Length);
+			}
+			else if (Next == Type::Extension)
+			{
+				if (Byte >= 0xD4)
+					Length = (1 << (Byte - 0xD4)) + 1;
+				else if (ReadBigEndian(Length, 1 << (Byte - 0xC7)))
+					Length++;
+				else
+					return;
+				SkipBytes(Length);
+			}
+			else if (Byte >= 0xCA && Byte <= 0xD3)
+			{
+				// float32, float64, uint8 ... uint64, int8 ... int64
+				static const uint8_t Widths[] = { 4, 8, 1, 2, 4, 8, 1, 2, 4, 8 };
+				SkipBytes(Widths[Byte - 0xCA]);
+			}
+			Remaining--;
+		}
+	}
+
+	bool MsgPackIn::ReadByte(uint8_t& Byte)
+	{
+		if (!Stream.WaitForData())
+		{
+			SetFailFlag(Fails::NoData);
+			return false;
+		}
+		Byte = Stream.Read();
+		return true;
+	}
+
+	bool MsgPackIn::ReadBigEndian(uint32_t& Data, uint8_t Bytes)
+	{
+		Data = 0;
+		uint8_t Byte;
+		for (uint8_t C = 0; C < Bytes; C++)
+		{
+			if (!ReadByte(Byte))
+				return false;
+			Data = (Data << 8) | Byte;
+		}
+		return true;
+	}
+
+	bool MsgPackIn::ReadBigEndian(uint64_t& Data)
+	{
+		uint32_t High, Low;
+		if (!ReadBigEndian(High, 4) || !ReadBigEndian(Low, 4))
+			return false;
+		Data = (static_cast<uint64_t>(High) << 32) | Low;
+		return true;
+	}
+
+	/**
+	 * @brief Reads any integer encoding that fits into 32 bits as sign and magnitude.
+	 * @details Values that need 64 bits lead to the fail flag ino::InStream::Fails::NotANumber being set, other types to ino::InStream::Fails::WrongFormat (the value is skipped).
+	 */
+	bool MsgPackIn::ReadInteger(uint32_t& Magnitude, bool& Negative)
+	{
+		Negative = false;
+		if (PeekType() != Type::Integer)
+		{
+			if (!Failed(Fails::NoData))
+			{
+				SetFailFlag(Fails::WrongFormat);
+				Skip();
+			}
+			return false;
+		}
+
+		uint8_t Byte = Stream.Read();
+		if (Byte <= 0x7F)
+		{
+			Magnitude = Byte;
+			return true;
+		}
+		else if (Byte >= 0xE0)
+		{
+			Negative = true;
+			Magnitude = 0x100 - Byte;
+			return true;
+		}
+		else if (Byte <= 0xCE)
+			return ReadBigEndian(Magnitude, 1 << (Byte - 0xCC));
+		else if (Byte >= 0xD0 && Byte <= 0xD2)
+		{
+			uint8_t Bytes = 1 << (Byte - 0xD0);
+			if (!ReadBigEndian(Magnitude, Bytes))
+				return false;
+			uint32_t SignBit = static_cast<uint32_t>(1) << (8 * Bytes - 1);
+			if (Magnitude & SignBit)
+			{
+				Negative = true;
+				Magnitude = (SignBit << 1) - Magnitude;
+			}
+			return true;
+		}
+
+		uint32_t High;
+		if (!ReadBigEndian(High, 4) || !ReadBigEndian(Magnitude, 4))
+			return false;
+		if (Byte == 0xD3 && (High & 0x80000000UL))
+		{
+			Negative = true;
+			if (High == 0xFFFFFFFFUL && Magnitude)
+			{
+				Magnitude = -Magnitude;
+				return true;
+			}
+		}
+		else if (High == 0)
+			return true;
+		SetFailFlag(Fails::NotANumber);
+		return false;
+	}
+
+	/**
+	 * @brief Reads any integer encoding as sign and magnitude. Other types lead to the fail flag ino::InStream::Fails::WrongFormat being set (the value is skipped).
+	 */
+	bool MsgPackIn::ReadInteger(uint64_t& Magnitude, bool& Negative)
+	{
+		uint8_t Byte = PeekType() == Type::Integer ? static_cast<uint8_t>(Stream.Peek()) : 0;
+		if (Byte != 0xCF && Byte != 0xD3)
+		{
+			uint32_t Magnitude32;
+			bool Success = ReadInteger(Magnitude32, Negative);
+			Magnitude = Magnitude32;
+			return Success;
+		}
+
+		Stream.Read();
+		if (!ReadBigEndian(Magnitude))
+			return false;
+		Negative = (Byte == 0xD3) && (Magnitude & 0x8000000000000000ULL);
+		if (Negative)
+			Magnitude = -Magnitude;
+		return true;
+	}
+
+	/**
+	 * @brief Reads float 32, float 64 and integer encodings. Other types lead to the fail flag ino::InStream::Fails::NotANumber being set (the value is skipped).
+	 */
+	bool MsgPackIn::ReadFloat(double& Data)
+	{
+		Type Next = PeekType();
+		if (Next == Type::Integer)
+		{
+			uint64_t Magnitude;
+			bool Negative;
+			if (!ReadInteger(Magnitude, Negative))
+				return false;
+			Data = Negative ? -static_cast<double>(Magnitude) : static_cast<double>(Magnitude);
+			return true;
+		}
+		else if (Next != Type::Float)
+		{
+			if (Next != Type::Invalid || !Failed(Fails::NoData))
+			{
+				SetFailFlag(Fails::NotANumber);
+				Skip();
+			}
+			return false;
+		}
+
+		if (static_cast<uint8_t>(Stream.Read()) == 0xCA)
+		{
+			uint32_t Bits;
+			if (!ReadBigEndian(Bits, 4))
+				return false;
+			float Value;
+			memcpy(&Value, &Bits, sizeof(Value));
+			Data = Value;
+			return true;
+		}
+
+		uint32_t High, Low;
+		if (!ReadBigEndian(High, 4) || !ReadBigEndian(Low, 4))
+			return false;
+		if (sizeof(double) == 8)
+		{
+			uint64_t Bits = (static_cast<uint64_t>(High) << 32) | Low;
+			memcpy(&Data, &Bits, sizeof(Data));
+		}
+		else
+			Data = DoubleBitsToFloat(High, Low);
+		return true;
+	}
+
+	bool MsgPackIn::ReadStringHeader(uint32_t& Length)
+	{
+		Type Next = PeekType();
+		if (Next != Type::String)
+		{
+			if (Next != Type::Invalid || !Failed(Fails::NoData))
+			{
+				SetFailFlag(Fails::WrongFormat);
+				Skip();
+			}
+			return false;
+		}
+		uint8_t Byte = Stream.Read();
+		if (Byte <= 0xBF)
+		{
+			Length = Byte & 0x1F;
+			return true;
+		}
+		return ReadBigEndian(Length, 1 << (Byte - 0xD9));
+	}
+
+	bool MsgPackIn::ReadContainerHeader(uint8_t Fix, uint8_t Type16, uint32_t& Size)
+	{
+		if (!Stream.WaitForData())
+		{
+			SetFailFlag(Fails::NoData);
+			return false;
+		}
+		uint8_t Byte = Stream.Peek();
+		if ((Byte & 0xF0) == Fix)
+		{
+			Stream.Read();
+			Size = Byte & 0x0F;
+			return true;
+		}
+		else if (Byte == Type16 || Byte == Type16 + 1)
+		{
+			Stream.Read();
+			return ReadBigEndian(Size, Byte == Type16 ? 2 : 4);
+		}
+		SetFailFlag(Fails::WrongFormat);
+		Skip();
+		return false;
+	}
+
+	/**
+	 * @brief Reads a string into a c-string according to the CStringFormat.
+	 * @details
+	 * 	Strings longer than `StringSize - 1` are truncated and the fail flag ino::InStream::Fails::WrongCString is set.
+	 * 	In ino::CStringFormats::Mode::Exact strings of any other length than `StringSize - 1` set the same fail flag.
+	 */
+	void MsgPackIn::ReadCString(char* Data, const CStringFormats& CString)
+	{
+		uint32_t Length;
+		if (!ReadStringHeader(Length))
+			return;
+		uint32_t Max = CString.StringSize - 1;
+		uint32_t C = 0;
+		uint8_t Byte;
+		for (; C < Length && C < Max && ReadByte(Byte); C++)
+			Data[C] = Byte;
+		Data[C] = '\0';
+		if (Length > Max)
+			SkipBytes(Length - Max);
+		if (Length > Max || (CString.StringMode == CStringFormats::Mode::Exact && Length != Max))
+			SetFailFlag(Fails::WrongCString);
+	}
+
+	void MsgPackIn::SkipBytes(uint32_t Length)
+	{
+		uint8_t Byte;
+		for (uint32_t C = 0; C < Length && ReadByte(Byte); C++);
+	}
+
+}
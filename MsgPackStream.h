@@ -0,0 +1,155 @@
+#pragma once
+#ifndef INO_MSGPACKSTREAM_INCLUDED
+#define INO_MSGPACKSTREAM_INCLUDED
+
+#include "InoCore.h"
+#include "OutStream.h"
+#include "InStream.h"
+
+#include <Arduino.h>
+
+namespace ino {
+
+	class MsgPackOut
+	{
+	private:
+		OutStream& Stream;
+
+	public:
+		MsgPackOut(OutStream& Stream) : Stream(Stream) {}
+
+		// * ----- Output operators (smallest encoding that represents the value) -----------------------------------------------------
+
+		template <typename T, typename std::enable_if<IsSigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value && !std::is_same<char, typename ReduceType<T>::type>::value, int>::type = 0>
+		inline MsgPackOut& operator<<(T Data) { WriteInteger(static_cast<typename std::conditional<(sizeof(T) > 4), int64_t, int32_t>::type>(Data)); return *this; }
+
+		template <typename T, typename std::enable_if<IsUnsigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value && !std::is_same<bool, typename ReduceType<T>::type>::value && !std::is_same<char, typename ReduceType<T>::type>::value, int>::type = 0>
+		inline MsgPackOut& operator<<(T Data) { WriteInteger(static_cast<typename std::conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type>(Data)); return *this; }
+
+		template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value, int>::type = 0>
+		inline MsgPackOut& operator<<(T Data) { if (sizeof(T) > sizeof(float)) WriteDouble(Data); else WriteFloat(Data); return *this; }
+
+		MsgPackOut& operator<<(bool Data);
+		MsgPackOut& operator<<(char Data);
+		MsgPackOut& operator<<(const char* Data);
+		MsgPackOut& operator<<(const String& Data);
+
+		template <typename T, typename std::enable_if<std::is_same<char*, typename ReduceType<T>::type>::value || IsElementType<char, T>::value, int>::type = 0>
+		MsgPackOut& operator<<(const CStringFormat<T>& Data)
+		{
+			uint32_t Length = 0;
+			if (Data.Val.StringMode == CStringFormats::Mode::Exact)
+				Length = Data.Val.StringSize - 1;
+			else
+				while (Length < static_cast<uint32_t>(Data.Val.StringSize - 1) && Data.Var[Length] != '\0')
+					Length++;
+			WriteString(Data.Var, Length);
+			return *this;
+		}
+
+		MsgPackOut& Nil();
+		MsgPackOut& BeginArray(uint32_t Size);
+		MsgPackOut& BeginMap(uint32_t Size);
+		MsgPackOut& Binary(const void* Data, uint32_t Size);
+
+	private:
+		void WriteInteger(int32_t Data);
+		void WriteInteger(int64_t Data);
+		void WriteInteger(uint32_t Data);
+		void WriteInteger(uint64_t Data);
+		void WriteFloat(float Data);
+		void WriteDouble(double Data);
+		void WriteString(const char* Data, uint32_t Length);
+		void WriteHeader(uint8_t Fix, uint8_t FixMax, uint8_t Type8, uint32_t Length);
+		void WriteBigEndian(uint8_t Type, uint32_t Data, uint8_t Bytes);
+		void WriteBigEndian(uint8_t Type, uint64_t Data);
+
+	};
+
+	class MsgPackIn
+	{
+	public:
+		using Fails = InStream::Fails;
+
+		enum class Type : uint8_t { Nil, Bool, Integer, Float, String, Binary, Array, Map, Extension, Invalid };
+
+	private:
+		InStream& Stream;
+		Fails FailFlags = Fails::NoFail;
+
+		inline void SetFailFlag(Fails Flag) { FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) | static_cast<typename std::underlying_type<Fails>::type>(Flag)); }
+
+	public:
+		MsgPackIn(InStream& Stream) : Stream(Stream) {}
+
+		inline bool Failed() const { return FailFlags != Fails::NoFail; }
+		inline bool Failed(Fails TestFlag) const { return static_cast<typename std::underlying_type<Fails>::type>(FailFlags) & static_cast<typename std::underlying_type<Fails>::type>(TestFlag); }
+		inline void ClearFails() { FailFlags = Fails::NoFail; }
+
+		Type PeekType();
+
+		// * ----- Input operators (accept every encoding that fits the type) ---------------------------------------------------------
+
+		template <typename T, typename std::enable_if<std::is_integral<typename ReduceTypeExceptConst<T>::type>::value && !std::is_same<bool, typename ReduceTypeExceptConst<T>::type>::value && !std::is_same<char, typename ReduceTypeExceptConst<T>::type>::value, int>::type = 0>
+		MsgPackIn& operator>>(T& Data)
+		{
+			using BaseT = typename ReduceTypeExceptConst<T>::type;
+			using U = typename std::conditional<(sizeof(BaseT) > 4), uint64_t, uint32_t>::type;
+			constexpr U Max = IsSigned<BaseT>::value ? (static_cast<U>(1) << (8 * sizeof(BaseT) - 1)) - 1 : (sizeof(BaseT) == sizeof(U) ? static_cast<U>(-1) : (static_cast<U>(1) << (8 * sizeof(BaseT))) - 1);
+
+			U Magnitude;
+			bool Negative;
+			if (!ReadInteger(Magnitude, Negative))
+				return *this;
+			if (Negative ? (!IsSigned<BaseT>::value || Magnitude - 1 > Max) : Magnitude > Max)
+				SetFailFlag(Fails::NotANumber);
+			else if (Negative)
+				Data = static_cast<BaseT>(-static_cast<BaseT>(Magnitude - 1) - 1);
+			else
+				Data = static_cast<BaseT>(Magnitude);
+			return *this;
+		}
+
+		template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceTypeExceptConst<T>::type>::value, int>::type = 0>
+		MsgPackIn& operator>>(T& Data)
+		{
+			double Value;
+			if (ReadFloat(Value))
+				Data = Value;
+			return *this;
+		}
+
+		MsgPackIn& operator>>(bool& Data);
+		MsgPackIn& operator>>(char& Data);
+		MsgPackIn& operator>>(String& Data);
+
+		template <typename T, typename std::enable_if<(std::is_same<char*, typename ReduceTypeExceptConst<T>::type>::value || IsElementTypeConsiderConst<char, T>::value) && std::is_lvalue_reference<T>::value, int>::type = 0>
+		MsgPackIn& operator>>(const CStringFormat<T>& Data)
+		{
+			ReadCString(Data.Var, Data.Val);
+			return *this;
+		}
+
+		bool ReadNil();
+		uint32_t ReadArray();
+		uint32_t ReadMap();
+		uint32_t ReadBinary(void* Data, uint32_t Size);
+		void Skip();
+
+	private:
+		bool ReadByte(uint8_t& Byte);
+		bool ReadBigEndian(uint32_t& Data, uint8_t Bytes);
+		bool ReadBigEndian(uint64_t& Data);
+		bool ReadInteger(uint32_t& Magnitude, bool& Negative);
+		bool ReadInteger(uint64_t& Magnitude, bool& Negative);
+		bool ReadFloat(double& Data);
+		bool ReadStringHeader(uint32_t& Length);
+		bool ReadContainerHeader(uint8_t Fix, uint8_t Type16, uint32_t& Size);
+		void ReadCString(char* Data, const CStringFormats& CString);
+		void SkipBytes(uint32_t Length);
+
+	};
+
+}
+
+#endif
@@ -1,6 +1,8 @@
 #include "InoCore.h"
 #include "OutStream.h"
 
+#include <string.h>
+
 namespace ino {
 
 	char OutStream::NumToChar(uint8_t Num)
@@ -21,6 +23,310 @@ namespace ino {
 			return Num + 87;
 	}
 
+	/**
+	 * @brief Writes the digits of `Num` in base `BaseVal` as a single block. Only instantiated for the 32 and 64 bit cores.
+	 */
+	template <typename U>
+	void OutStream::WriteDigits(U Num, uint8_t BaseVal, const CaseFormats& Case)
+	{
+		char Digits[8 * sizeof(U)];
+		uint8_t Pos = sizeof(Digits);
+		if (BaseVal == 10)
+		{
+			do {
+				Digits[--Pos] = '0' + Num % 10;
+				Num /= 10;
+			} while (Num);
+		}
+		else
+		{
+			do {
+				Digits[--Pos] = NumToChar(Num % BaseVal, Case);
+				Num /= BaseVal;
+			} while (Num);
+		}
+		InternalWriteBlock(Digits + Pos, sizeof(Digits) - Pos);
+	}
+
+	void OutStream::WriteBasePrefix(const BaseFormats& Base)
+	{
+		if (Base.BaseMode == BaseFormats::Mode::PrefixFormat && (Base.BaseVal == 2 || Base.BaseVal == 8 || Base.BaseVal == 10 || Base.BaseVal == 16))
+		{
+			if (Base.BaseVal == 2)
+				InternalWrite('B');
+			else if (Base.BaseVal == 8)
+				InternalWrite('0');
+			else if (Base.BaseVal == 16)
+				InternalWriteBlock("0x", 2);
+		}
+		else if (Base.BaseMode != BaseFormats::Mode::NoFormat)
+		{
+			// Full format (ex. "<B5>"), also used as prefix of bases without a prefix of their own
+			InternalWriteBlock("<B", 2);
+			WriteDigits(static_cast<uint32_t>(Base.BaseVal), 10, Fmt::Uppercase);
+			InternalWrite('>');
+		}
+#if INO_DEBUG
+		if (Base.BaseVal < 2)
+		{
+			DefaultCString("Error: ino runtime debug error: Tried to print with base less than 2 (from ");
+			DefaultCString(__FILE__);
+			InternalWrite(':');
+			DefaultUnsignedInt(__LINE__);
+			DefaultCString(")\n");
+		}
+#endif
+	}
+
+	/**
+	 * @brief Writes the integer part of a floating point number of 2^32 and above with all its digits exact, ex. the largest `float` as `340282346638528859811704183484516925440`.
+	 * @details
+	 * 	The number is split into 16 bit parts, which is exact because they are multiples of powers of two, and the parts are accumulated in base 10^4, so no rounding happens.
+	 * 	A part of base 10^4 shifted by 16 bits plus the carry stays below 2^32, so only 32 bit multiplications and divisions by a constant are needed (no 64 bit division, which is slow on AVR).
+	 */
+	template <typename T>
+	void OutStream::WriteLargeInteger(T Integer)
+	{
+		constexpr uint16_t PartCount = sizeof(T) <= 4 ? 10 : (sizeof(T) <= 8 ? 78 : 1234); // Base 10^4 parts of the largest finite value
+		uint16_t Parts[PartCount]; // Least significant first
+		uint16_t Used = 0;
+
+		const T Radix = static_cast<T>(65536.0);
+		T Scale = 1;
+		while (Integer / Scale >= Radix)
+			Scale *= Radix;
+		for (; Scale >= 1; Scale /= Radix)
+		{
+			T High;
+			ModFunction(Integer / Scale, High);
+			Integer -= High * Scale;
+			uint32_t Carry = static_cast<uint16_t>(High);
+			for (uint16_t Part = 0; Part < Used; Part++)
+			{
+				uint32_t Value = (static_cast<uint32_t>(Parts[Part]) << 16) + Carry;
+				Carry = Value / 10000;
+				Parts[Part] = static_cast<uint16_t>(Value - Carry * 10000);
+			}
+			for (; Carry; Carry /= 10000)
+				Parts[Used++] = static_cast<uint16_t>(Carry % 10000);
+		}
+
+		WriteDigits(Parts[Used - 1], 10, Fmt::Uppercase);
+		for (uint16_t Part = Used - 1; Part-- > 0; )
+		{
+			char Digits[4];
+			uint16_t Value = Parts[Part];
+			for (uint8_t Pos = sizeof(Digits); Pos-- > 0; Value /= 10)
+				Digits[Pos] = '0' + Value % 10;
+			InternalWriteBlock(Digits, sizeof(Digits));
+		}
+	}
+
+	/**
+	 * @brief Formats a floating point number into `Block` (ino::OutStream::FloatBlockSize characters), so that it is written as a single block.
+	 * @return Returns the number of characters, `0` if the number does not fit (special numbers, integer parts of 2^32 and above, more than 16 decimals). WriteFloat() writes those piece by piece.
+	 */
+	template <typename T>
+	uint8_t OutStream::FormatFloat(char* Block, T Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision)
+	{
+		if (INO_OUTSTREAM_NANFUNC(Num) || INO_OUTSTREAM_INFFUNC(Num) || INO_OUTSTREAM_NINFFUNC(Num))
+			return 0;
+
+		uint8_t Length = 0;
+		if (Num < 0)
+		{
+			Block[Length++] = '-';
+			Num = -Num;
+		}
+		T Integer;
+		T Fraction = ModFunction(Num, Integer);
+
+		DecimalsRound Decimals = { Precision, false };
+		if (Precision == AutomaticPrecision)
+		{
+			Decimals = GetTotalDecimals(Fraction);
+			if (Decimals.Decimals == 0 && Decimals.Round)
+				Integer += 1;
+		}
+		if (!(Integer < static_cast<T>(4294967296.0)) || Decimals.Decimals > FloatBlockSize - 12)
+			return 0;
+
+		char Digits[10];
+		uint8_t Pos = sizeof(Digits);
+		uint32_t Whole = static_cast<uint32_t>(Integer);
+		do {
+			Digits[--Pos] = '0' + Whole % 10;
+			Whole /= 10;
+		} while (Whole);
+		memcpy(Block + Length, Digits + Pos, sizeof(Digits) - Pos);
+		Length += sizeof(Digits) - Pos;
+
+		if (Decimals.Decimals)
+		{
+			Block[Length++] = Decimalpoint == Fmt::DecimalDot ? '.' : ',';
+			for (uint8_t C = 0; C < Decimals.Decimals; C++)
+			{
+				Fraction *= 10;
+				if (C == Decimals.Decimals - 1 && Decimals.Round)
+					Block[Length++] = static_cast<int>(Fraction) + 1 + 48;
+				else
+					Block[Length++] = static_cast<int>(Fraction) + 48;
+				Fraction -= static_cast<int>(Fraction);
+			}
+		}
+		return Length;
+	}
+
+	uint8_t OutStream::FloatBlock(char* Block, double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision)
+	{
+		return FormatFloat(Block, Num, Decimalpoint, Precision);
+	}
+
+	uint8_t OutStream::FloatBlock(char* Block, long double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision)
+	{
+		return FormatFloat(Block, Num, Decimalpoint, Precision);
+	}
+
+	/**
+	 * @brief Writes a floating point number. Precision ino::OutStream::AutomaticPrecision prints as many decimals as needed (at most 6, see GetTotalDecimals()).
+	 * @details Most numbers are formatted by FormatFloat() and written as a single block, the rest piece by piece.
+	 */
+	template <typename T>
+	void OutStream::WriteFloat(T Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		char Block[FloatBlockSize];
+		uint8_t Length = FormatFloat(Block, Num, Decimalpoint, Precision);
+		if (Length)
+		{
+			InternalWriteBlock(Block, Length);
+			return;
+		}
+
+		if (INO_OUTSTREAM_NANFUNC(Num)) {
+			DefaultFormatString(Specialnum.Nan, Specialnum.InFlash);
+			return;
+		}
+		else if (INO_OUTSTREAM_INFFUNC(Num)) {
+			DefaultFormatString(Specialnum.PosInf, Specialnum.InFlash);
+			return;
+		}
+		else if (INO_OUTSTREAM_NINFFUNC(Num)) {
+			DefaultFormatString(Specialnum.NegInf, Specialnum.InFlash);
+			return;
+		}
+
+		if (Num < 0)
+		{
+			InternalWrite('-');
+			Num = -Num;
+		}
+		T Integer;
+		T Fraction = ModFunction(Num, Integer);
+
+		DecimalsRound Decimals = { Precision, false };
+		if (Precision == AutomaticPrecision)
+		{
+			Decimals = GetTotalDecimals(Fraction);
+			if (Decimals.Decimals == 0 && Decimals.Round)
+				Integer += 1;
+		}
+
+		if (Integer < static_cast<T>(4294967296.0))
+			WriteDigits(static_cast<uint32_t>(Integer), 10, Fmt::Uppercase);
+		else
+			WriteLargeInteger(Integer);
+
+		if (Decimals.Decimals)
+		{
+			InternalWrite(Decimalpoint == Fmt::DecimalDot ? '.' : ',');
+			for (uint8_t C = 0; C < Decimals.Decimals; C++)
+			{
+				Fraction *= 10;
+				if (C == Decimals.Decimals - 1 && Decimals.Round)
+					InternalWrite(static_cast<int>(Fraction) + 1 + 48);
+				else
+					InternalWrite(static_cast<int>(Fraction) + 48);
+				Fraction -= static_cast<int>(Fraction);
+			}
+		}
+	}
+
+	/**
+	 * @brief Writes a string from program memory (PROGMEM). The characters are read with `pgm_read_byte()` into a buffer of `INO_OUTSTREAM_FLASHBUFFERSIZE` characters on the stack and written in blocks, the string is never copied to RAM as a whole.
+	 * @details On host builds program memory is ordinary memory, the string is written as a single block.
+	 */
+	void OutStream::DefaultFlashString(const char* Data)
+	{
+#ifdef INO_HOST
+		InternalWriteBlock(Data, strlen(Data));
+#else
+		char Buffer[INO_OUTSTREAM_FLASHBUFFERSIZE];
+		uint8_t Length = 0;
+		for (char Character = pgm_read_byte(Data); Character != '\0'; Character = pgm_read_byte(++Data))
+		{
+			Buffer[Length++] = Character;
+			if (Length == sizeof(Buffer))
+			{
+				InternalWriteBlock(Buffer, Length);
+				Length = 0;
+			}
+		}
+		if (Length)
+			InternalWriteBlock(Buffer, Length);
+#endif
+	}
+
+	// * ----- Formatting cores ---------------------------------------------------------------------------------------------------
+
+	void OutStream::UnsignedCore(uint32_t Num, const BaseFormats& Base, const CaseFormats& Case)
+	{
+		WriteBasePrefix(Base);
+		WriteDigits(Num, Base.BaseVal, Case);
+	}
+
+	void OutStream::UnsignedCore(uint64_t Num, const BaseFormats& Base, const CaseFormats& Case)
+	{
+		if (Num <= 0xFFFFFFFFULL)
+		{
+			UnsignedCore(static_cast<uint32_t>(Num), Base, Case);
+			return;
+		}
+		WriteBasePrefix(Base);
+		WriteDigits(Num, Base.BaseVal, Case);
+	}
+
+	void OutStream::SignedCore(int32_t Num, const BaseFormats& Base, const CaseFormats& Case)
+	{
+		if (Num < 0)
+		{
+			InternalWrite('-');
+			UnsignedCore(static_cast<uint32_t>(0) - static_cast<uint32_t>(Num), Base, Case);
+		}
+		else
+			UnsignedCore(static_cast<uint32_t>(Num), Base, Case);
+	}
+
+	void OutStream::SignedCore(int64_t Num, const BaseFormats& Base, const CaseFormats& Case)
+	{
+		if (Num < 0)
+		{
+			InternalWrite('-');
+			UnsignedCore(static_cast<uint64_t>(0) - static_cast<uint64_t>(Num), Base, Case);
+		}
+		else
+			UnsignedCore(static_cast<uint64_t>(Num), Base, Case);
+	}
+
+	void OutStream::FloatCore(double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		WriteFloat(Num, Decimalpoint, Precision, Specialnum);
+	}
+
+	void OutStream::FloatCore(long double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum)
+	{
+		WriteFloat(Num, Decimalpoint, Precision, Specialnum);
+	}
+
 #ifdef INO_OUTSTREAM_CURSORTRACKER
 	void OutStream::InternalWrite(char Character)
 	{
@@ -35,124 +341,175 @@ namespace ino {
 		}
 		else
 			CursorPos.Num++;
+#ifdef INO_STREAMSTATS
+		Stats.Bytes++;
+#endif
 		Write(Character);
 	}
+
+	void OutStream::InternalWriteBlock(const char* Data, unsigned int Length)
+	{
+		for (unsigned int C = 0; C < Length; C++)
+		{
+			if (Data[C] == '\n')
+			{
+				CursorPos.Line++;
+				CursorPos.Num = 0;
+			}
+			else if (Data[C] == '\t')
+			{
+				CursorPos.Num += INO_OUTSTREAM_CURSORTRACKER_TABSIZE - (CursorPos.Num % INO_OUTSTREAM_CURSORTRACKER_TABSIZE);
+			}
+			else
+				CursorPos.Num++;
+		}
+#ifdef INO_STREAMSTATS
+		Stats.Bytes += Length;
+#endif
+		WriteBlock(Data, Length);
+	}
 #endif
 
 	// * ----- Default output operators (always decimal, char as character) -------------------------------------------------------
 
 	OutStream& OutStream::operator<<(char Data) {
+		INO_STREAMTRACE_OPERATOR();
 		InternalWrite(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(signed char Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(unsigned char Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(short Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(unsigned short Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(int Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(unsigned int Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(long Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(unsigned long Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(long long Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(unsigned long long Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(float Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(double Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(long double Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(bool Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultBool(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(const String& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultString(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(const volatile String& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultString(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(const char* Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data);
 		FinishTransfer();
 		return *this;
 	}
 
 	OutStream& OutStream::operator<<(const volatile char* Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data);
 		FinishTransfer();
 		return *this;
 	}
 
+	OutStream& OutStream::operator<<(const __FlashStringHelper* Data) {
+		INO_STREAMTRACE_OPERATOR();
+		DefaultFlashString(reinterpret_cast<const char*>(Data));
+		FinishTransfer();
+		return *this;
+	}
+
 }
@@ -4,6 +4,7 @@
 
 #include "InoCore.h"
 #include "StreamBase.h"
+#include "StreamStats.h"
 #include "Utility.h"
 
 #include <Arduino.h>
@@ -23,6 +24,10 @@
 #define INO_OUTSTREAM_NINFFUNC(Arg) ::ino::IEEE754::isninf(Arg)
 #endif
 
+#ifndef INO_OUTSTREAM_FLASHBUFFERSIZE
+#define INO_OUTSTREAM_FLASHBUFFERSIZE 16
+#endif
+
 #ifdef INO_OUTSTREAM_CURSORTRACKER
 #ifndef INO_OUTSTREAM_CURSORTRACKER_TABSIZE
 #define INO_OUTSTREAM_CURSORTRACKER_TABSIZE 8
@@ -35,8 +40,32 @@ namespace ino {
 	{
 	protected:
 		virtual void Write(char Character) = 0;
+		virtual void WriteBlock(const char* Data, unsigned int Length) { for (unsigned int C = 0; C < Length; C++) Write(Data[C]); }
+
+	private:
+		uint8_t TransferDepth = 0; // Open ino::OutStream::Transfer scopes
 
 	public:
+		inline OutStream& Put(char Character) { InternalWrite(Character); return *this; }
+		inline OutStream& Put(const char* Data, unsigned int Length) { InternalWriteBlock(Data, Length); return *this; }
+
+		/**
+		 * @brief Makes everything written while it exists (operators and `Put()`) a single transfer, ex. in output operators of own types: `ino::OutStream::Transfer Scope(Stream); Stream << X << ',' << Y;`
+		 * @details The transfer is finished once, when the outermost scope ends, inner operators do not write the transfer end.
+		 */
+		class Transfer
+		{
+		private:
+			OutStream& Stream;
+			char End;
+
+		public:
+			inline Transfer(OutStream& Stream) : Stream(Stream), End(Stream.GetEnd()) { Stream.NoEnd(); Stream.TransferDepth++; }
+			inline ~Transfer() { Stream.SetEnd(End); if (--Stream.TransferDepth == 0) Stream.FinishTransfer(); }
+
+			Transfer(const Transfer&) = delete;
+			Transfer& operator=(const Transfer&) = delete;
+		};
 
 		// * ----- Default output operators (always decimal, char as character) -------------------------------------------------------
 
@@ -62,6 +91,7 @@ namespace ino {
 		OutStream& operator<<(const volatile String& Data);
 		OutStream& operator<<(const char* Data);
 		OutStream& operator<<(const volatile char* Data);
+		OutStream& operator<<(const __FlashStringHelper* Data);
 
 
 		// * ----- Base-specific output operators -------------------------------------------------------------------------------------
@@ -163,6 +193,12 @@ namespace ino {
 
 		template <typename T, typename... FmtTs, typename std::enable_if<(std::is_same<char*, typename ReduceType<T>::type>::value || IsElementType<char, T>::value) && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<CStringFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type = 0>
 		OutStream& operator<<(const MultiFormat<T, FmtTs...>& Data);
+
+		  //------ Range output operator (defined in StreamRange.h) ------------------------------------------------------------------
+
+		template <typename T, typename... FmtTs>
+		OutStream& operator<<(const RangeFormat<T, FmtTs...>& Data);
+		friend class RangeElementWriter;
 	
 #ifdef INO_OUTSTREAM_CURSORTRACKER
 	public: 
@@ -171,45 +207,60 @@ namespace ino {
 	private:
 		CursorPosition CursorPos;
 		void InternalWrite(char Character);
+		void InternalWriteBlock(const char* Data, unsigned int Length);
 
 	public:
 		inline const CursorPosition& GetCursorPos() const { return CursorPos; }
 #endif
 
 	private: // Private helper functions
-		template <size_t size, typename std::enable_if<size == 1, int>::type = 1>
-		constexpr static int GetMaxLengthDecHelper() { return 3; }
-		template <size_t size, typename std::enable_if<size == 2, int>::type = 1>
-		constexpr static int GetMaxLengthDecHelper() { return 5; }
-		template <size_t size, typename std::enable_if<size == 4, int>::type = 1>
-		constexpr static int GetMaxLengthDecHelper() { return 10; }
-		template <size_t size, typename std::enable_if<size == 8, int>::type = 1>
-		constexpr static int GetMaxLengthDecHelper() { return 20; }
-
-		template <typename T, bool IsIntegral>
-		struct IntegralTypeHelper
-		{
-			using type = T;
-		};
+		template <typename U>
+		void WriteDigits(U Num, uint8_t BaseVal, const CaseFormats& Case);
+		void WriteBasePrefix(const BaseFormats& Base);
 		template <typename T>
-		struct IntegralTypeHelper<T, false>
-		{
-			using type = int;
-		};
+		void WriteFloat(T Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
+		template <typename T>
+		static uint8_t FormatFloat(char* Block, T Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision);
+		static uint8_t FloatBlock(char* Block, double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision);
+		static uint8_t FloatBlock(char* Block, long double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision);
+		template <typename T>
+		void WriteLargeInteger(T Integer);
 
 #ifndef INO_OUTSTREAM_CURSORTRACKER
+#ifdef INO_STREAMSTATS
+		inline void InternalWrite(char Character) { Stats.Bytes++; Write(Character); }
+		inline void InternalWriteBlock(const char* Data, unsigned int Length) { Stats.Bytes += Length; WriteBlock(Data, Length); }
+#else
 		inline void InternalWrite(char Character) { Write(Character); }
+		inline void InternalWriteBlock(const char* Data, unsigned int Length) { WriteBlock(Data, Length); }
+#endif
 #endif
 
-	protected: // Helper functions
-		template <size_t size>
-		struct GetMaxLengthDec : std::integral_constant<int, GetMaxLengthDecHelper<size>()> {};
+#ifdef INO_STREAMSTATS
+	private:
+		OutStreamStats Stats;
 
+	protected:
+		// For derived streams: `Start` is the INO_STREAMSTATS_MICROS() value taken before waiting for the underlaying stream
+		inline void AddBlockedTime(unsigned long Start) { Stats.BlockedMicros += INO_STREAMSTATS_MICROS() - Start; }
+		inline void AddOccupancy(unsigned int Occupancy) { if (Occupancy > Stats.PeakOccupancy) Stats.PeakOccupancy = Occupancy > 0xFFFF ? 0xFFFF : Occupancy; }
+
+	public:
+		inline OutStreamStats GetStats() const { return Stats; }
+		inline void ResetStats() { Stats = OutStreamStats(); }
+#endif
+
+	protected: // Helper functions
+		// Every integral type is widened to the 32 or 64 bit core, every floating point type to the `double` or `long double` core
 		template <typename T>
-		struct IntegralType
-		{
-			using type = typename IntegralTypeHelper<T, std::is_integral<T>::value>::type;
-		};
+		using UnsignedCoreType = typename std::conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type;
+		template <typename T>
+		using SignedCoreType = typename std::conditional<(sizeof(T) > 4), int64_t, int32_t>::type;
+		template <typename T>
+		using FloatCoreType = typename std::conditional<(sizeof(T) > sizeof(double)), long double, double>::type;
+
+		constexpr static uint8_t AutomaticPrecision = 0xFF; // Precision argument of FloatCore(), the number of decimals is figured out by GetTotalDecimals()
+		constexpr static uint8_t FloatBlockSize = 28; // Characters of a number formatted by FormatFloat(): sign, 10 integer digits, decimal point and up to 16 decimals
 
 		template <typename T>
 		static inline T GetDecimalPart(T Num)
@@ -266,45 +317,24 @@ namespace ino {
 			return ReturnVal;
 		}
 
-		static inline String GetBaseFullFormat(uint8_t BaseVal)
-		{
-			return String("<B") + String(BaseVal) + String(">");
-		}
-
-		static inline String GetBasePrefix(uint8_t BaseVal)
-		{
-			constexpr const char* BinPrefix = "B";
-			constexpr const char* OctPrefix = "0";
-			constexpr const char* DecPrefix = "";
-			constexpr const char* HexPrefix = "0x";
-
-			if      (BaseVal == 10) return DecPrefix;
-			else if (BaseVal == 16) return HexPrefix;
-			else if (BaseVal == 2)  return BinPrefix;
-			else if (BaseVal == 8)  return OctPrefix;
-			else return GetBaseFullFormat(BaseVal);
-		}
-
 		static char NumToChar(uint8_t Num, const CaseFormats&);
 		static char NumToChar(uint8_t Num);
 
 	protected: // Underlaying stream functions
-		template <typename T>
-		inline void Negative(T&& Num)
-		{
-			//Serial.println("Custom note from .......Negative(T&&)");
-			//Serial.println(Num < 0 ? "negative" : "positive");
-			if (Num < 0)
-			{
-				InternalWrite('-');
-				Num = -Num;
-			}
-		}
-
 		inline void FinishTransfer()
 		{
+#if defined(INO_STREAMSTATS) || defined(INO_STREAMTRACE)
+			if (TransferDepth) // Part of an ino::OutStream::Transfer, which counts and traces once
+				return;
+#endif
+#ifdef INO_STREAMSTATS
+			Stats.Transfers++;
+#endif
 			if (TransferEnd != -1)
 				InternalWrite(TransferEnd);
+#ifdef INO_STREAMTRACE
+			TraceTransfer();
+#endif
 		}
 		
 		template <typename T>
@@ -313,6 +343,15 @@ namespace ino {
 			for (int C = 0; Data[C] != '\0'; C++)
 				InternalWrite(Data[C]);
 		}
+		void DefaultFlashString(const char* Data);
+		inline void DefaultFormatString(const char* Data, bool InFlash)
+		{
+			if (InFlash)
+				DefaultFlashString(Data);
+			else
+				DefaultCString(Data);
+		}
+
 		template <typename T>
 		inline void DefaultCString(const T* Data, const CaseFormats& Case)
 		{
@@ -358,100 +397,24 @@ namespace ino {
 			}
 		}
 
-		template <typename T>
-		inline void DefaultUnsignedInt(T Num)
-		{
-			constexpr size_t MaxLength = GetMaxLengthDec<sizeof(typename std::remove_reference<T>::type)>::value + 1;
-			char CString[MaxLength];
-
-			int Pos = 0;
-			do {
-				CString[Pos++] = NumToChar(ModOperator(Num, 10));
-				Num /= 10;
-			} while (static_cast<typename IntegralType<T>::type>(Num));
-
-			do {
-				InternalWrite(CString[--Pos]);
-			} while (Pos > 0);
-		}
-		template <typename T>
-		inline void DefaultUnsignedInt(T Num, const BaseFormats& Base)
-		{
-			constexpr size_t MaxLength = 8 * sizeof(typename std::remove_reference<T>::type) + 1;
-			char CString[MaxLength];
-
-			if (Base.BaseMode == BaseFormats::Mode::PrefixFormat)
-				DefaultString(GetBasePrefix(Base.BaseVal));
-			else if (Base.BaseMode == BaseFormats::Mode::FullFormat)
-				DefaultString(GetBaseFullFormat(Base.BaseVal));
-#if INO_DEBUG
-			if (Base.BaseVal < 2)
-			{
-				DefaultCString("Error: ino runtime debug error: Tried to print with base less than 2 (from ");
-				DefaultCString(__FILE__);
-				InternalWrite(':');
-				DefaultUnsignedInt(__LINE__);
-				DefaultCString(")\n");
-			}
-#endif
-			int Pos = 0;
-			do {
-				CString[Pos++] = NumToChar(ModOperator(Num, Base.BaseVal));
-				Num /= Base.BaseVal;
-			} while (static_cast<typename IntegralType<T>::type>(Num));
-
-			do {
-				InternalWrite(CString[--Pos]);
-			} while (Pos > 0);
-		}
-		template <typename T>
-		inline void DefaultUnsignedInt(T Num, const BaseFormats& Base, const CaseFormats& Case)
-		{
-			constexpr size_t MaxLength = 8 * sizeof(typename std::remove_reference<T>::type) + 1;
-			char CString[MaxLength];
-
-			if (Base.BaseMode == BaseFormats::Mode::PrefixFormat)
-				DefaultString(GetBasePrefix(Base.BaseVal));
-			else if (Base.BaseMode == BaseFormats::Mode::FullFormat)
-				DefaultString(GetBaseFullFormat(Base.BaseVal));
-#if INO_DEBUG
-			if (Base.BaseVal < 2)
-			{
-				DefaultCString("Error: ino runtime debug error: Tried to print with base less than 2 (from ");
-				DefaultCString(__FILE__);
-				InternalWrite(':');
-				DefaultUnsignedInt(__LINE__);
-				DefaultCString(")\n");
-			}
-#endif
-			int Pos = 0;
-			do {
-				CString[Pos++] = NumToChar(ModOperator(Num, Base.BaseVal), Case);
-				Num /= Base.BaseVal;
-			} while (static_cast<typename IntegralType<T>::type>(Num));
-
-			do {
-				InternalWrite(CString[--Pos]);
-			} while (Pos > 0);
-		}
+		// Out-of-line formatting cores (OutStream.cpp), the templates below only widen their argument and forward to them
+		void UnsignedCore(uint32_t Num, const BaseFormats& Base, const CaseFormats& Case);
+		void UnsignedCore(uint64_t Num, const BaseFormats& Base, const CaseFormats& Case);
+		void SignedCore(int32_t Num, const BaseFormats& Base, const CaseFormats& Case);
+		void SignedCore(int64_t Num, const BaseFormats& Base, const CaseFormats& Case);
+		void FloatCore(double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
+		void FloatCore(long double Num, const DecimalpointFormats& Decimalpoint, uint8_t Precision, const SpecialnumberFormats& Specialnum);
 
 		template <typename T>
-		inline void DefaultSignedInt(T Num)
-		{
-			Negative(Num);
-			DefaultUnsignedInt(Num);
-		}
-		template <typename T>
-		inline void DefaultSignedInt(T Num, const BaseFormats& Base)
+		inline void DefaultUnsignedInt(T Num, const BaseFormats& Base = Fmt::Dec, const CaseFormats& Case = Fmt::Uppercase)
 		{
-			Negative(Num);
-			DefaultUnsignedInt(Num, Base);
+			UnsignedCore(static_cast<UnsignedCoreType<T>>(Num), Base, Case);
 		}
+
 		template <typename T>
-		inline void DefaultSignedInt(T Num, const BaseFormats& Base, const CaseFormats& Case)
+		inline void DefaultSignedInt(T Num, const BaseFormats& Base = Fmt::Dec, const CaseFormats& Case = Fmt::Uppercase)
 		{
-			Negative(Num);
-			DefaultUnsignedInt(Num, Base, Case);
+			SignedCore(static_cast<SignedCoreType<T>>(Num), Base, Case);
 		}
 
 		inline void DefaultChar(char Character, const CaseFormats& Case)
@@ -488,302 +451,42 @@ namespace ino {
 		template <typename T>
 		inline void DefaultFloat(T Num)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.NegInf);
-				return;
-			}
-
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			auto Decimals = GetTotalDecimals(Fraction);
-			if (Decimals.Decimals == 0 && Decimals.Round)
-				DefaultSignedInt(Integer + 1);
-			else
-				DefaultSignedInt(Integer);
-
-			if (Decimals.Decimals)
-			{
-				InternalWrite('.');
-				for (int C = 0; C < Decimals.Decimals; C++)
-				{
-					Fraction *= 10;
-					if (C == Decimals.Decimals - 1 && Decimals.Round)
-						InternalWrite(static_cast<int>(Fraction) + 1 + 48);
-					else
-						InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Fmt::DecimalDot, AutomaticPrecision, Fmt::SpecialnumberShort);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const DecimalpointFormats& Decimalpoint)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.NegInf);
-				return;
-			}
-			
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			auto Decimals = GetTotalDecimals(Fraction);
-			if (Decimals.Decimals == 0 && Decimals.Round)
-				DefaultSignedInt(Integer + 1);
-			else
-				DefaultSignedInt(Integer);
-
-			if (Decimals.Decimals)
-			{
-				if (Decimalpoint == Fmt::DecimalDot)
-					InternalWrite('.');
-				else 
-					InternalWrite(',');
-				for (int C = 0; C < Decimals.Decimals; C++)
-				{
-					Fraction *= 10;
-					if (C == Decimals.Decimals - 1 && Decimals.Round)
-						InternalWrite(static_cast<int>(Fraction) + 1 + 48);
-					else
-						InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Decimalpoint, AutomaticPrecision, Fmt::SpecialnumberShort);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const PrecisionFormats& Precision)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.NegInf);
-				return;
-			}
-			
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			DefaultSignedInt(Integer);
-			if (Precision.PrecisionVal)
-			{
-				InternalWrite('.');
-				for (int C = 0; C < Precision.PrecisionVal; C++)
-				{
-					Fraction *= 10;
-					InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Fmt::DecimalDot, Precision.PrecisionVal, Fmt::SpecialnumberShort);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const SpecialnumberFormats& Specialnum)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Specialnum.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Specialnum.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Specialnum.NegInf);
-				return;
-			}		
-
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			auto Decimals = GetTotalDecimals(Fraction);
-			if (Decimals.Decimals == 0 && Decimals.Round)
-				DefaultSignedInt(Integer + 1);
-			else
-				DefaultSignedInt(Integer);
-
-			if (Decimals.Decimals)
-			{
-				InternalWrite('.');
-				for (int C = 0; C < Decimals.Decimals; C++)
-				{
-					Fraction *= 10;
-					if (C == Decimals.Decimals - 1 && Decimals.Round)
-						InternalWrite(static_cast<int>(Fraction) + 1 + 48);
-					else
-						InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Fmt::DecimalDot, AutomaticPrecision, Specialnum);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Fmt::SpecialnumberShort.NegInf);
-				return;
-			}
-			
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			DefaultSignedInt(Integer);
-			if (Precision.PrecisionVal)
-			{
-				if (Decimalpoint == Fmt::DecimalDot)
-					InternalWrite('.');
-				else 
-					InternalWrite(',');
-				for (int C = 0; C < Precision.PrecisionVal; C++)
-				{
-					Fraction *= 10;
-					InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Decimalpoint, Precision.PrecisionVal, Fmt::SpecialnumberShort);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const DecimalpointFormats& Decimalpoint, const SpecialnumberFormats& Specialnum)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Specialnum.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Specialnum.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Specialnum.NegInf);
-				return;
-			}	
-			
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			auto Decimals = GetTotalDecimals(Fraction);
-			if (Decimals.Decimals == 0 && Decimals.Round)
-				DefaultSignedInt(Integer + 1);
-			else
-				DefaultSignedInt(Integer);
-
-			if (Decimals.Decimals)
-			{
-				if (Decimalpoint == Fmt::DecimalDot)
-					InternalWrite('.');
-				else 
-					InternalWrite(',');
-				for (int C = 0; C < Decimals.Decimals; C++)
-				{
-					Fraction *= 10;
-					if (C == Decimals.Decimals - 1 && Decimals.Round)
-						InternalWrite(static_cast<int>(Fraction) + 1 + 48);
-					else
-						InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Decimalpoint, AutomaticPrecision, Specialnum);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Specialnum.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Specialnum.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Specialnum.NegInf);
-				return;
-			}	
-
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			DefaultSignedInt(Integer);
-			if (Precision.PrecisionVal)
-			{
-				InternalWrite('.');
-				for (int C = 0; C < Precision.PrecisionVal; C++)
-				{
-					Fraction *= 10;
-					InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Fmt::DecimalDot, Precision.PrecisionVal, Specialnum);
 		}
 		template <typename T>
 		inline void DefaultFloat(T Num, const DecimalpointFormats& Decimalpoint, const PrecisionFormats& Precision, const SpecialnumberFormats& Specialnum)
 		{
-			if (INO_OUTSTREAM_NANFUNC(Num)) {
-				DefaultCString(Specialnum.Nan);
-				return;
-			}
-			else if (INO_OUTSTREAM_INFFUNC(Num)) {
-				DefaultCString(Specialnum.PosInf);
-				return;
-			}
-			else if (INO_OUTSTREAM_NINFFUNC(Num)) {
-				DefaultCString(Specialnum.NegInf);
-				return;
-			}	
-
-			Negative(Num);
-			T Integer;
-			T Fraction = ModFunction(Num, Integer);
-
-			DefaultSignedInt(Integer);
-			if (Precision.PrecisionVal)
-			{
-				if (Decimalpoint == Fmt::DecimalDot)
-					InternalWrite('.');
-				else 
-					InternalWrite(',');
-				for (int C = 0; C < Precision.PrecisionVal; C++)
-				{
-					Fraction *= 10;
-					InternalWrite(static_cast<int>(Fraction) + 48);
-					Fraction -= static_cast<int>(Fraction);
-				}
-			}
+			FloatCore(static_cast<FloatCoreType<T>>(Num), Decimalpoint, Precision.PrecisionVal, Specialnum);
 		}
 
 		inline void DefaultBool(bool Val)
@@ -794,18 +497,12 @@ namespace ino {
 			else
 				Write('0');
 #else
-			if (Val)
-				DefaultCString("true");
-			else
-				DefaultCString("false");
+			DefaultBool(Val, Fmt::BoolWord);
 #endif
 		}
 		inline void DefaultBool(bool Val, const BoolFormats& BoolFmt)
 		{
-			if (Val)
-				DefaultCString(BoolFmt.BoolTrue);
-			else
-				DefaultCString(BoolFmt.BoolFalse);
+			DefaultFormatString(Val ? BoolFmt.BoolTrue : BoolFmt.BoolFalse, BoolFmt.InFlash);
 		}
 
 	};
@@ -815,6 +512,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<IsSigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const BaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -824,6 +522,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<IsUnsigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const BaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -835,6 +534,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_same<char, typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const CaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultChar(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -844,6 +544,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_same<char*, typename ReduceType<T>::type>::value || IsElementType<char, T>::value, int>::type>
 	OutStream& OutStream::operator<<(const CaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -853,6 +554,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_same<String, typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const CaseFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultString(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -864,6 +566,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_same<bool, typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const BoolFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultBool(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -875,6 +578,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const DecimalpointFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -886,6 +590,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const PrecisionFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -897,6 +602,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value, int>::type>
 	OutStream& OutStream::operator<<(const SpecialnumberFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -908,6 +614,7 @@ namespace ino {
 
 	template <typename T, typename std::enable_if<std::is_same<char*, typename ReduceType<T>::type>::value || IsElementType<char, T>::value, int>::type>
 	OutStream& OutStream::operator<<(const CStringFormat<T>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data.Var, Data.Val);
 		FinishTransfer();
 		return *this;
@@ -919,6 +626,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<IsSigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<BaseFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultSignedInt(Data.Var, Data.template Get<BaseFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -928,6 +636,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<IsUnsigned<typename ReduceType<T>::type>::value && std::is_integral<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<BaseFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultUnsignedInt(Data.Var, Data.template Get<BaseFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -937,6 +646,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<PrecisionFormats>());
 		FinishTransfer();
 		return *this;
@@ -946,6 +656,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -955,6 +666,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<PrecisionFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -964,6 +676,7 @@ namespace ino {
 
 	template <typename T, typename... FmtTs, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value && sizeof...(FmtTs) == 3 && MultiFormat<T, FmtTs...>::template Contains<DecimalpointFormats>::value && MultiFormat<T, FmtTs...>::template Contains<PrecisionFormats>::value && MultiFormat<T, FmtTs...>::template Contains<SpecialnumberFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultFloat(Data.Var, Data.template Get<DecimalpointFormats>(), Data.template Get<PrecisionFormats>(), Data.template Get<SpecialnumberFormats>());
 		FinishTransfer();
 		return *this;
@@ -973,6 +686,7 @@ namespace ino {
 	  
 	template <typename T, typename... FmtTs, typename std::enable_if<(std::is_same<char*, typename ReduceType<T>::type>::value || IsElementType<char, T>::value) && sizeof...(FmtTs) == 2 && MultiFormat<T, FmtTs...>::template Contains<CStringFormats>::value && MultiFormat<T, FmtTs...>::template Contains<CaseFormats>::value, int>::type>
 	OutStream& OutStream::operator<<(const MultiFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
 		DefaultCString(Data.Var, Data.template Get<CStringFormats>(), Data.template Get<CaseFormats>());
 		FinishTransfer();
 		return *this;
@@ -11,10 +11,11 @@ namespace ino {
 	class PIOPinInStream : public InStream, virtual public PinStream
 	{
 	public:
-		PIOPinInStream(SoftwareSerial& SerialRef) : PinStream(SerialRef) {}
+		PIOPinInStream(SerialType& SerialRef) : PinStream(SerialRef) {}
 		
 		virtual inline char Peek() const override { return Buffer[0]; }
 		virtual inline unsigned int Available() const override { return Buffer.length(); }
+		virtual inline bool PollReady() const override { return Buffer.length() || SerialRef.available(); }
 
 		bool Run() const;
 		virtual inline char Read() override { char RetVal =  Buffer[0]; Buffer.remove(0, 1); return RetVal; }
@@ -26,7 +27,7 @@ namespace ino {
 		
 	protected:
 
-		virtual inline bool NoDataAvailable() override { while(!Run()); return true; }
+		virtual inline bool NoDataAvailable() override { return WaitUntil([this] { return Run(); }); }
 
 	};
 
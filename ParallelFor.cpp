@@ -0,0 +1,120 @@
+#include "InoCore.h"
+#include "ParallelFor.h"
+
+#ifdef INO_HOST
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ino {
+
+	namespace {
+
+		/**
+		 * @brief Range of indices owned by one thread, packed into a single word so that taking from the front and stealing from the back are both one compare-and-swap.
+		 */
+		struct WorkRange
+		{
+			std::atomic<uint64_t> Range{0};
+			char Padding[64 - sizeof(std::atomic<uint64_t>)]; // Keeps the ranges of different threads in different cache lines
+
+			static inline uint64_t Pack(uint32_t Begin, uint32_t End) { return static_cast<uint64_t>(End) << 32 | Begin; }
+			static inline uint32_t Begin(uint64_t Packed) { return static_cast<uint32_t>(Packed); }
+			static inline uint32_t End(uint64_t Packed) { return static_cast<uint32_t>(Packed >> 32); }
+
+			bool Take(uint32_t& Index)
+			{
+				uint64_t Current = Range.load(std::memory_order_acquire);
+				while (Begin(Current) < End(Current))
+				{
+					if (Range.compare_exchange_weak(Current, Pack(Begin(Current) + 1, End(Current)), std::memory_order_acq_rel))
+					{
+						Index = Begin(Current);
+						return true;
+					}
+				}
+				return false;
+			}
+
+			bool StealHalf(uint32_t& StolenBegin, uint32_t& StolenEnd)
+			{
+				uint64_t Current = Range.load(std::memory_order_acquire);
+				while (Begin(Current) < End(Current))
+				{
+					uint32_t Remaining = End(Current) - Begin(Current);
+					uint32_t Split = End(Current) - (Remaining + 1) / 2;
+					if (Range.compare_exchange_weak(Current, Pack(Begin(Current), Split), std::memory_order_acq_rel))
+					{
+						StolenBegin = Split;
+						StolenEnd = End(Current);
+						return true;
+					}
+				}
+				return false;
+			}
+		};
+
+		void RunWorker(WorkRange* Ranges, unsigned int Count, unsigned int Self, const std::function<void(size_t)>& Work)
+		{
+			while (true)
+			{
+				uint32_t Index;
+				while (Ranges[Self].Take(Index))
+					Work(Index);
+
+				bool Stolen = false;
+				for (unsigned int Offset = 1; Offset < Count && !Stolen; Offset++)
+				{
+					uint32_t Begin, End;
+					if (Ranges[(Self + Offset) % Count].StealHalf(Begin, End))
+					{
+						// Only the owner refills its range and it is empty, so a plain store is enough
+						Ranges[Self].Range.store(WorkRange::Pack(Begin, End), std::memory_order_release);
+						Stolen = true;
+					}
+				}
+				if (!Stolen)
+					return;
+			}
+		}
+
+	}
+
+	unsigned int ParallelThreads(unsigned int Threads)
+	{
+		if (Threads)
+			return Threads;
+		Threads = std::thread::hardware_concurrency();
+		return Threads ? Threads : 1;
+	}
+
+	void ParallelFor(size_t Count, unsigned int Threads, const std::function<void(size_t)>& Work)
+	{
+		Threads = ParallelThreads(Threads);
+		if (Threads > Count)
+			Threads = Count;
+		if (Threads <= 1)
+		{
+			for (size_t Index = 0; Index < Count; Index++)
+				Work(Index);
+			return;
+		}
+
+		std::unique_ptr<WorkRange[]> Ranges(new WorkRange[Threads]);
+		for (unsigned int T = 0; T < Threads; T++)
+			Ranges[T].Range.store(WorkRange::Pack(Count * T / Threads, Count * (T + 1) / Threads), std::memory_order_relaxed);
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(Threads - 1);
+		for (unsigned int T = 1; T < Threads; T++)
+			Workers.emplace_back(RunWorker, Ranges.get(), Threads, T, std::cref(Work));
+		RunWorker(Ranges.get(), Threads, 0, Work);
+		for (std::thread& Worker : Workers)
+			Worker.join();
+	}
+
+}
+
+#endif
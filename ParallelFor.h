@@ -0,0 +1,30 @@
+#pragma once
+#ifndef INO_PARALLELFOR_INCLUDED
+#define INO_PARALLELFOR_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include <functional>
+
+namespace ino {
+
+	/**
+	 * @brief Calls `Work(Index)` for every index in `[0, Count)` on up to `Threads` threads (host only, `0` uses all cores). Returns when all calls are done.
+	 * @details
+	 * 	Every thread starts with an equal share of the indices and takes them from the front. A thread that runs out steals the back half of the share of another thread, so uneven work is balanced without a shared queue.
+	 * 	The calling thread takes part in the work.
+	 */
+	void ParallelFor(size_t Count, unsigned int Threads, const std::function<void(size_t)>& Work);
+
+	/**
+	 * @brief Returns the number of threads ino::ParallelFor() uses for `Threads`.
+	 */
+	unsigned int ParallelThreads(unsigned int Threads = 0);
+
+}
+
+#endif
+
+#endif
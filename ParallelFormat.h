@@ -0,0 +1,124 @@
+#pragma once
+#ifndef INO_PARALLELFORMAT_INCLUDED
+#define INO_PARALLELFORMAT_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "OutStream.h"
+#include "StreamRange.h"
+#include "ParallelFor.h"
+
+#include <string.h>
+#include <vector>
+
+#ifndef INO_PARALLELFORMAT_CHUNKSIZE
+#define INO_PARALLELFORMAT_CHUNKSIZE 65536
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Output stream appending to a growing `std::vector<char>` (host only).
+	 */
+	class VectorOutStream : public OutStream
+	{
+	private:
+		std::vector<char>& Buffer;
+
+	protected:
+		virtual inline void Write(char Character) override { Buffer.push_back(Character); }
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override { Buffer.insert(Buffer.end(), Data, Data + Length); }
+
+	public:
+		VectorOutStream(std::vector<char>& Buffer) : Buffer(Buffer) {}
+	};
+
+	/**
+	 * @brief Formats the chunks of a range in parallel, every chunk into its own buffer. Chunks after the first start with the separator, so the concatenation of all chunks equals the output of the range output operator without transfer end.
+	 */
+	template <typename T, typename... FmtTs>
+	std::vector<std::vector<char>> FormatChunks(const RangeFormat<T, FmtTs...>& Data, unsigned int Threads)
+	{
+		size_t Count = (Data.Size + INO_PARALLELFORMAT_CHUNKSIZE - 1) / INO_PARALLELFORMAT_CHUNKSIZE;
+		size_t MinCount = static_cast<size_t>(ParallelThreads(Threads)) * 4;
+		if (Count < MinCount)
+			Count = MinCount;
+		if (Count > Data.Size)
+			Count = Data.Size ? Data.Size : 1;
+
+		const char* Separator = Data.Separator.SeparatorVal ? Data.Separator.SeparatorVal : &Data.Separator.SeparatorChar;
+		unsigned int SeparatorLength = Data.Separator.SeparatorVal ? strlen(Data.Separator.SeparatorVal) : 1;
+
+		std::vector<std::vector<char>> Chunks(Count);
+		ParallelFor(Count, Threads, [&](size_t Index)
+		{
+			size_t Begin = Data.Size * Index / Count;
+			size_t End = Data.Size * (Index + 1) / Count;
+			RangeFormat<T, FmtTs...> Chunk = Data;
+			Chunk.Var += Begin;
+			Chunk.Size = End - Begin;
+
+			std::vector<char>& Buffer = Chunks[Index];
+			VectorOutStream Stream(Buffer);
+			if (Index && Chunk.Size)
+				Stream.Put(Separator, SeparatorLength);
+			Stream << Chunk;
+		});
+		return Chunks;
+	}
+
+	/**
+	 * @brief Formats a range (see ino::Range()) on several threads (host only, `Threads = 0` uses all cores) into one contiguous buffer.
+	 * @details
+	 * 	The range is split into chunks of `INO_PARALLELFORMAT_CHUNKSIZE` elements. Every chunk is formatted into its own buffer with the usual output operators, then the output is allocated once with the summed size and the chunks are copied to their offsets in parallel.
+	 * 	The result is byte-identical to `Stream << Range` on a single thread (without the transfer end), as elements are formatted independently of each other.
+	 *
+	 * 	Ex. `std::vector<char> Text = ino::ParallelFormat(ino::Range(Samples, ino::Sep('\n'), ino::PrecisionFormats(6)));`
+	 */
+	template <typename T, typename... FmtTs>
+	std::vector<char> ParallelFormat(const RangeFormat<T, FmtTs...>& Data, unsigned int Threads = 0)
+	{
+		std::vector<std::vector<char>> Chunks = FormatChunks(Data, Threads);
+		std::vector<size_t> Offsets(Chunks.size() + 1, 0);
+		for (size_t C = 0; C < Chunks.size(); C++)
+			Offsets[C + 1] = Offsets[C] + Chunks[C].size();
+
+		std::vector<char> Output(Offsets.back());
+		ParallelFor(Chunks.size(), Threads, [&](size_t Index)
+		{
+			memcpy(Output.data() + Offsets[Index], Chunks[Index].data(), Chunks[Index].size());
+			std::vector<char>().swap(Chunks[Index]);
+		});
+		return Output;
+	}
+
+	/**
+	 * @brief Formats a range on several threads like ino::ParallelFormat() and writes it to `Stream` in order, one block per chunk. The transfer is finished once like with `Stream << Range`.
+	 */
+	template <typename T, typename... FmtTs>
+	OutStream& ParallelWrite(OutStream& Stream, const RangeFormat<T, FmtTs...>& Data, unsigned int Threads = 0)
+	{
+		std::vector<std::vector<char>> Chunks = FormatChunks(Data, Threads);
+		OutStream::Transfer Scope(Stream);
+		for (std::vector<char>& Chunk : Chunks)
+		{
+			for (size_t Written = 0; Written < Chunk.size(); )
+			{
+				size_t Length = Chunk.size() - Written;
+				if (Length > 0x40000000)
+					Length = 0x40000000;
+				Stream.Put(Chunk.data() + Written, Length);
+				Written += Length;
+			}
+			std::vector<char>().swap(Chunk);
+		}
+		return Stream;
+	}
+
+}
+
+#endif
+
+#endif
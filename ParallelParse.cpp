@@ -0,0 +1,34 @@
+#include "InoCore.h"
+#include "ParallelParse.h"
+
+#ifdef INO_HOST
+
+namespace ino {
+
+	std::vector<ParseChunk> SplitAtDelimiter(const char* Data, size_t Size, char Delimiter, size_t Count)
+	{
+		std::vector<ParseChunk> Chunks;
+		if (!Count)
+			Count = 1;
+		Chunks.reserve(Count);
+		size_t Begin = 0;
+		for (size_t C = 1; C <= Count && Begin < Size; C++)
+		{
+			size_t End = C == Count ? Size : Size / Count * C;
+			if (End <= Begin)
+				continue;
+			if (End < Size)
+			{
+				// Extend to just after the next delimiter
+				const char* Next = static_cast<const char*>(memchr(Data + End - 1, Delimiter, Size - End + 1));
+				End = Next ? Next - Data + 1 : Size;
+			}
+			Chunks.push_back(ParseChunk{ Data + Begin, End - Begin });
+			Begin = End;
+		}
+		return Chunks;
+	}
+
+}
+
+#endif
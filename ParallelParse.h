@@ -0,0 +1,108 @@
+#pragma once
+#ifndef INO_PARALLELPARSE_INCLUDED
+#define INO_PARALLELPARSE_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "InStream.h"
+#include "SpanInStream.h"
+#include "ParallelFor.h"
+
+#include <string.h>
+#include <utility>
+#include <vector>
+
+#ifndef INO_PARALLELPARSE_CHUNKSIZE
+#define INO_PARALLELPARSE_CHUNKSIZE 262144
+#endif
+
+namespace ino {
+
+	struct ParseChunk
+	{
+		const char* Data;
+		size_t Size;
+	};
+
+	/**
+	 * @brief Splits `Data` into about `Count` chunks of similar size that all end directly after a `Delimiter` (or at the end of `Data`).
+	 */
+	std::vector<ParseChunk> SplitAtDelimiter(const char* Data, size_t Size, char Delimiter, size_t Count);
+
+	/**
+	 * @brief Parses all records of `Data` that are separated by `Delimiter` in parallel (host only) and returns the results in the order of the records.
+	 * @details
+	 * 	`Data` is split into chunks of about `INO_PARALLELPARSE_CHUNKSIZE` characters at delimiter boundaries, the chunks are parsed on a work-stealing thread pool (see ino::ParallelFor()) and the results of the chunks are merged in order.
+	 * 	Every record is parsed by `Parse(InStream& Record, T& Result)` from an ino::SpanInStream over the record without the delimiter, which has `Delimiter` set as transfer end. The record is kept, if `Parse` returns true.
+	 * 	`Parse` is called concurrently and must not modify shared state.
+	 *
+	 * 	Ex.
+	 * 	`ino::MappedFileInStream File("capture.log");`
+	 * 	`auto Samples = ino::ParallelParse<Sample>(File.PeekSpan(), File.SpanSize(), '\n', [](ino::InStream& Record, Sample& S) { Record >> ino::Range(S.Fields); return Record.GetFails() == ino::InStream::Fails::NoFail; });`
+	 */
+	template <typename T, typename ParseFunction>
+	std::vector<T> ParallelParse(const char* Data, size_t Size, char Delimiter, ParseFunction Parse, unsigned int Threads = 0)
+	{
+		size_t Count = Size / INO_PARALLELPARSE_CHUNKSIZE + 1;
+		size_t MinCount = static_cast<size_t>(ParallelThreads(Threads)) * 4;
+		if (Count < MinCount)
+			Count = MinCount;
+		std::vector<ParseChunk> Chunks = SplitAtDelimiter(Data, Size, Delimiter, Count);
+		std::vector<std::vector<T>> Parts(Chunks.size());
+
+		ParallelFor(Chunks.size(), Threads, [&](size_t Index)
+		{
+			const char* Begin = Chunks[Index].Data;
+			const char* End = Begin + Chunks[Index].Size;
+			std::vector<T>& Results = Parts[Index];
+			while (Begin < End)
+			{
+				const char* RecordEnd = static_cast<const char*>(memchr(Begin, Delimiter, End - Begin));
+				if (!RecordEnd)
+					RecordEnd = End;
+				if (RecordEnd > Begin)
+				{
+					SpanInStream Record(Begin, RecordEnd - Begin);
+					Record.SetEnd(Delimiter);
+					T Result;
+					if (Parse(static_cast<InStream&>(Record), Result))
+						Results.push_back(std::move(Result));
+				}
+				Begin = RecordEnd + 1;
+			}
+		});
+
+		size_t Total = 0;
+		for (const std::vector<T>& Part : Parts)
+			Total += Part.size();
+		std::vector<T> Results;
+		Results.reserve(Total);
+		for (std::vector<T>& Part : Parts)
+		{
+			for (T& Result : Part)
+				Results.push_back(std::move(Result));
+			std::vector<T>().swap(Part);
+		}
+		return Results;
+	}
+
+	/**
+	 * @brief Parses every record with `Record >> Result` and keeps the records without fail flags.
+	 */
+	template <typename T>
+	std::vector<T> ParallelParse(const char* Data, size_t Size, char Delimiter, unsigned int Threads = 0)
+	{
+		return ParallelParse<T>(Data, Size, Delimiter, [](InStream& Record, T& Result)
+		{
+			Record >> Result;
+			return Record.GetFails() == InStream::Fails::NoFail;
+		}, Threads);
+	}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+#include "InoCore.h"
+#include "ParseError.h"
+#include "OutStream.h"
+
+namespace ino {
+
+	namespace {
+
+		const __FlashStringHelper* TokenName(ParseError::Tokens Token)
+		{
+			switch (Token)
+			{
+			case ParseError::Tokens::Digit: return F("digit");
+			case ParseError::Tokens::BaseFormat: return F("base format");
+			case ParseError::Tokens::DecimalPoint: return F("decimal point");
+			case ParseError::Tokens::SpecialNumber: return F("special number");
+			case ParseError::Tokens::BoolWord: return F("bool");
+			case ParseError::Tokens::Letter: return F("letter of the case");
+			case ParseError::Tokens::TransferEnd: return F("end of value");
+			case ParseError::Tokens::MoreData: return F("more characters");
+			case ParseError::Tokens::Element: return F("element");
+			default: return F("nothing");
+			}
+		}
+
+		const __FlashStringHelper* OperatorName(ParseError::Operators Operator)
+		{
+			switch (Operator)
+			{
+			case ParseError::Operators::Integer: return F("integer");
+			case ParseError::Operators::Float: return F("float");
+			case ParseError::Operators::Bool: return F("bool");
+			case ParseError::Operators::Char: return F("char");
+			case ParseError::Operators::CString: return F("C-string");
+			case ParseError::Operators::Range: return F("range");
+			default: return F("unknown");
+			}
+		}
+
+	}
+
+	/**
+	 * @brief Name of a bit of ino::InStream::Fails, `nullptr` for unused bits.
+	 */
+	const __FlashStringHelper* FailName(uint8_t Bit)
+	{
+		switch (Bit)
+		{
+		case 0: return F("NotANumber");
+		case 2: return F("NotABool");
+		case 3: return F("NotAChar");
+		case 4: return F("WrongFormat");
+		case 5: return F("WrongBase");
+		case 6: return F("WrongCase");
+		case 7: return F("WrongDecimalPoint");
+		case 8: return F("WrongPrecision");
+		case 10: return F("WrongCString");
+		case 11: return F("NoData");
+		case 12: return F("Timeout");
+		default: return nullptr;
+		}
+	}
+
+	/**
+	 * @brief Prints the error as a single transfer, ex. `WrongBase at 3: 'z', expected digit (integer)` or `WrongCString at 4: end of transfer, expected more characters (C-string)`.
+	 * @details Offending characters that are not printable are written as their code, ex. `byte 10`.
+	 */
+	OutStream& operator<<(OutStream& Stream, const ParseError& Error)
+	{
+		OutStream::Transfer Scope(Stream);
+		if (!Error.Fail)
+			Stream << F("no parse error");
+		else
+		{
+			uint8_t Bit = 0;
+			while (!(Error.Fail & (1 << Bit)))
+				Bit++;
+			const __FlashStringHelper* Name = FailName(Bit);
+			if (Name)
+				Stream << Name;
+			else
+				Stream << F("bit") << Bit;
+			Stream << F(" at ") << Error.Offset << F(": ");
+			if (Error.Offending == -1)
+				Stream << F("end of transfer");
+			else if (Error.Offending >= ' ' && Error.Offending <= '~')
+				Stream.Put('\'').Put(static_cast<char>(Error.Offending)).Put('\'');
+			else
+				Stream << F("byte ") << static_cast<uint8_t>(Error.Offending);
+			Stream << F(", expected ") << TokenName(Error.Expected) << F(" (") << OperatorName(Error.Operator);
+			Stream.Put(')');
+		}
+		return Stream;
+	}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef INO_PARSEERROR_INCLUDED
+#define INO_PARSEERROR_INCLUDED
+
+#include "InoCore.h"
+
+#include <Arduino.h>
+
+namespace ino {
+
+	class OutStream;
+
+	/**
+	 * @brief Where and why an input operator failed, see ino::InStream::GetParseError (only filled when INO_PARSEERRORS is defined).
+	 * @details The first parse error after ino::InStream::ClearFails is kept, later errors of the same transfer are mostly consequences of it.
+	 */
+	struct ParseError
+	{
+		// Input operator that failed, all integral types are `Integer`, all floating point types `Float`
+		enum class Operators : uint8_t {
+			None,
+			Integer,
+			Float,
+			Bool,
+			Char,
+			CString,
+			Range,
+		};
+
+		// Token the operator expected instead of the offending character
+		enum class Tokens : uint8_t {
+			None,
+			Digit,			// Digit of the base (or of a decimal number)
+			BaseFormat,		// Base format like `<b5>`
+			DecimalPoint,	// Decimal point of the decimal point format
+			SpecialNumber,	// Special number word like `nan` or `inf`
+			BoolWord,		// `0`, `1` or a bool word like `true`
+			Letter,			// Letter of the case format
+			TransferEnd,	// End of the value, more characters followed (ex. more decimals than the precision)
+			MoreData,		// More characters, the value ended early (ex. too short exact C-string)
+			Element,		// Non-empty element of ino::Range, or no more elements than the range holds
+		};
+
+		uint16_t Offset = 0;					// Characters of the transfer read before the offending character
+		int16_t Offending = -1;					// Offending character, `-1` if the transfer ended
+		uint16_t Fail = 0;						// Fail flag that was set (ino::InStream::Fails), `0` if there was no parse error
+		Tokens Expected = Tokens::None;
+		Operators Operator = Operators::None;
+	};
+
+	const __FlashStringHelper* FailName(uint8_t Bit);
+
+	OutStream& operator<<(OutStream& Stream, const ParseError& Error);
+
+}
+
+#endif
@@ -12,9 +12,10 @@ namespace ino {
 	{
 	protected:
 		virtual inline void Write(char Character) override { SerialRef.write(Character); }
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override { SerialRef.write(reinterpret_cast<const uint8_t*>(Data), Length); }
 
 	public:
-		PinOutStream(SoftwareSerial& SerialRef) : PinStream(SerialRef) {}
+		PinOutStream(SerialType& SerialRef) : PinStream(SerialRef) {}
 
 	};
 
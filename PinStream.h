@@ -4,18 +4,29 @@
 
 #include "InoCore.h"
 
+#ifdef INO_HOST
+#include "SerialSimulator.h"
+#else
 #include <SoftwareSerial.h>
+#endif
 
 namespace ino {
 
 	class PinStream
 	{
+	public:
+#ifdef INO_HOST
+		using SerialType = SerialPort;
+#else
+		using SerialType = SoftwareSerial;
+#endif
+
 	protected:
-		SoftwareSerial& SerialRef;
+		SerialType& SerialRef;
 		unsigned long SerialBaud;
 
 	public:
-		PinStream(SoftwareSerial& SerialRef) : SerialRef(SerialRef) {}
+		PinStream(SerialType& SerialRef) : SerialRef(SerialRef) {}
 
     	virtual void begin(unsigned long SerialBaud) { SerialRef.begin(SerialBaud); this->SerialBaud = SerialBaud; }
     	virtual void end() { SerialRef.end(); }
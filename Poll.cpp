@@ -0,0 +1,78 @@
+#include "InoCore.h"
+#include "Poll.h"
+
+#ifdef INO_HOST
+#include <errno.h>
+#include <poll.h>
+#endif
+
+namespace ino {
+
+#ifdef INO_HOST
+	namespace {
+
+		/**
+		 * @brief Waits with `poll()` on the file descriptors of the streams. If some streams have none, the wait is cut to `INO_WAITSTRATEGY_HOSTSLEEP`, so they are checked again soon.
+		 * @return Returns `false` if no stream has a file descriptor.
+		 */
+		bool WaitOnFds(InStream* const* Streams, uint8_t Count, long Remaining)
+		{
+			pollfd Fds[32];
+			nfds_t FdCount = 0;
+			for (uint8_t Index = 0; Index < Count; Index++)
+			{
+				int Fd = Streams[Index]->PollFd();
+				if (Fd < 0)
+					continue;
+				Fds[FdCount].fd = Fd;
+				Fds[FdCount].events = POLLIN;
+				Fds[FdCount].revents = 0;
+				FdCount++;
+			}
+			if (!FdCount)
+				return false;
+
+			int Wait = static_cast<int>(Remaining);
+			if (FdCount < Count)
+			{
+				int Slice = (INO_WAITSTRATEGY_HOSTSLEEP + 999) / 1000;
+				if (Wait < 0 || Wait > Slice)
+					Wait = Slice;
+			}
+			while (::poll(Fds, FdCount, Wait) < 0 && errno == EINTR);
+			return true;
+		}
+
+	}
+#endif
+
+	/**
+	 * @brief Waits until at least one of the `Count` (at most 32) input streams has data, see ino::Poll.
+	 * @details Every stream is checked with ino::InStream::PollReady in every round, so none of them is starved. On host, streams on a file descriptor (ex. ino::FdInStream) are waited on with `poll()` instead of `Wait`.
+	 */
+	uint32_t PollStreams(InStream* const* Streams, uint8_t Count, long Timeout, const WaitStrategy& Wait)
+	{
+		unsigned long Start = Clock::Millis();
+		while (true)
+		{
+			uint32_t Ready = 0;
+			for (uint8_t Index = 0; Index < Count; Index++)
+			{
+				if (Streams[Index]->PollReady())
+					Ready |= static_cast<uint32_t>(1) << Index;
+			}
+			if (Ready)
+				return Ready;
+
+			unsigned long Waited = Clock::Millis() - Start;
+			if (Timeout >= 0 && Waited >= static_cast<unsigned long>(Timeout))
+				return 0;
+#ifdef INO_HOST
+			if (WaitOnFds(Streams, Count, Timeout < 0 ? -1 : Timeout - static_cast<long>(Waited)))
+				continue;
+#endif
+			Wait.Pause();
+		}
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+#ifndef INO_POLL_INCLUDED
+#define INO_POLL_INCLUDED
+
+#include "InoCore.h"
+#include "InStream.h"
+#include "WaitStrategy.h"
+
+namespace ino {
+
+	uint32_t PollStreams(InStream* const* Streams, uint8_t Count, long Timeout = -1, const WaitStrategy& Wait = WaitStrategy(WaitModes::Sleep));
+
+	/**
+	 * @brief Waits until at least one of up to 32 input streams has data, ex. `uint32_t Ready = ino::Poll({ &Radio, &Console }, 100);`
+	 * @param Timeout Longest wait in milliseconds, `0` only checks, `-1` waits forever.
+	 * @param Wait How to wait between two checks, by default the controller sleeps until the next interrupt (ex. a received byte).
+	 * @return Returns a mask of the ready streams, bit `i` for `Streams[i]`, `0` after the timeout.
+	 */
+	template <size_t N>
+	inline uint32_t Poll(InStream* const (&Streams)[N], long Timeout = -1, const WaitStrategy& Wait = WaitStrategy(WaitModes::Sleep))
+	{
+		static_assert(N <= 32, "ino::Poll: at most 32 streams");
+		return PollStreams(Streams, static_cast<uint8_t>(N), Timeout, Wait);
+	}
+
+}
+
+#endif
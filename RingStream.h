@@ -0,0 +1,64 @@
+#pragma once
+#ifndef INO_RINGSTREAM_INCLUDED
+#define INO_RINGSTREAM_INCLUDED
+
+#include "InoCore.h"
+#include "OutStream.h"
+#include "InStream.h"
+#include "SpscRing.h"
+
+namespace ino {
+
+	/**
+	 * @brief Input stream reading from the consumer side of an ino::SpscRing. Like ino::SerialInStream it waits for the producer when no data is available.
+	 */
+	template <size_t N>
+	class RingInStream : public InStream
+	{
+	private:
+		SpscRing<N>& Ring;
+
+	protected:
+		virtual inline bool NoDataAvailable() override { return WaitUntil([this] { return !Ring.Empty(); }); }
+
+	public:
+		RingInStream(SpscRing<N>& Ring) : Ring(Ring) {}
+
+		virtual inline char Peek() const override { return Ring.Peek(); }
+		virtual inline unsigned int Available() const override { return Ring.Available(); }
+		virtual inline char Read() override { char Character = '\0'; Ring.Pop(Character); return Character; }
+
+		inline size_t ReadBlock(char* Data, size_t Length) { return Ring.Pop(Data, Length); }
+
+	};
+
+	/**
+	 * @brief Output stream writing to the producer side of an ino::SpscRing. When the ring is full, it waits for the consumer instead of dropping bytes, so it must not be used from the consumer's context.
+	 */
+	template <size_t N>
+	class RingOutStream : public OutStream
+	{
+	private:
+		SpscRing<N>& Ring;
+
+	protected:
+		virtual inline void Write(char Character) override { while (!Ring.Push(Character)); WakeWaiting(); }
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override
+		{
+			while (Length)
+			{
+				size_t Pushed = Ring.Push(Data, Length);
+				Data += Pushed;
+				Length -= Pushed;
+			}
+			WakeWaiting();
+		}
+
+	public:
+		RingOutStream(SpscRing<N>& Ring) : Ring(Ring) {}
+
+	};
+
+}
+
+#endif
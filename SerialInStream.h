@@ -12,14 +12,14 @@ namespace ino {
 	{
 	protected:
 
-		virtual inline bool NoDataAvailable() override { while(!Available()); return true; }
+		virtual inline bool NoDataAvailable() override { return WaitUntil([this] { return Available() != 0; }); }
 		
 	public:
-		SerialInStream(HardwareSerial& SerialRef) : SerialStream(SerialRef) {}
+		SerialInStream(SerialType& SerialRef) : SerialStream(SerialRef) {}
 
 		virtual inline char Peek() const override { return SerialRef.peek(); }
 		virtual inline unsigned int Available() const override { return SerialRef.available(); }
-		virtual inline char Read() override { char Char = SerialRef.read(); delayMicroseconds(10000000 / SerialBaud); return Char; }
+		virtual inline char Read() override { char Char = SerialRef.read(); delayMicroseconds((10000000 + SerialBaud - 1) / SerialBaud); return Char; }
 
 	};
 
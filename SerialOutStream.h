@@ -11,10 +11,38 @@ namespace ino {
 	class SerialOutStream : public OutStream, virtual public SerialStream
 	{
 	protected:
+#ifdef INO_STREAMSTATS
+		// The write blocks when the transmit buffer of the serial port has not enough space left
+		virtual inline void Write(char Character) override
+		{
+			if (SerialRef.availableForWrite() >= 1)
+			{
+				SerialRef.write(Character);
+				return;
+			}
+			unsigned long Start = INO_STREAMSTATS_MICROS();
+			SerialRef.write(Character);
+			AddBlockedTime(Start);
+		}
+
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override
+		{
+			if (static_cast<unsigned int>(SerialRef.availableForWrite()) >= Length)
+			{
+				SerialRef.write(reinterpret_cast<const uint8_t*>(Data), Length);
+				return;
+			}
+			unsigned long Start = INO_STREAMSTATS_MICROS();
+			SerialRef.write(reinterpret_cast<const uint8_t*>(Data), Length);
+			AddBlockedTime(Start);
+		}
+#else
 		virtual inline void Write(char Character) override { SerialRef.write(Character); }
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override { SerialRef.write(reinterpret_cast<const uint8_t*>(Data), Length); }
+#endif
 
 	public:
-		SerialOutStream(HardwareSerial& SerialRef) : SerialStream(SerialRef) {}
+		SerialOutStream(SerialType& SerialRef) : SerialStream(SerialRef) {}
 
 	};
 
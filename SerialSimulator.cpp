@@ -0,0 +1,192 @@
+#include "InoCore.h"
+#include "SerialSimulator.h"
+
+#ifdef INO_HOST
+
+namespace ino {
+
+	VirtualClock SimulationClock;
+
+	// * ----- VirtualClock -------------------------------------------------------------------------------------------------------
+
+	namespace {
+
+		VirtualClock* Installed = nullptr;
+
+		unsigned long InstalledMicros() { return Installed->Micros(); }
+		unsigned long InstalledMillis() { return Installed->Millis(); }
+
+	}
+
+	VirtualClock::~VirtualClock()
+	{
+		if (Installed == this)
+		{
+			Installed = nullptr;
+			Clock::Set(nullptr, nullptr);
+		}
+	}
+
+	void VirtualClock::Install()
+	{
+		Installed = this;
+		Clock::Set(&InstalledMicros, &InstalledMillis);
+	}
+
+	// * ----- SerialWire ---------------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Moves all bytes whose frame is complete into the receive buffer.
+	 */
+	void SerialWire::Update()
+	{
+		while (!InFlight.empty() && InFlight.front().Arrival <= Clock.Nanos())
+		{
+			if (Rx.size() < RxCapacity)
+			{
+				Rx.push_back(InFlight.front().Byte);
+				Delivered++;
+			}
+			else
+			{
+				Overflowed = true;
+				Dropped++;
+			}
+			InFlight.pop_front();
+		}
+	}
+
+	void SerialWire::Send(uint8_t Byte)
+	{
+		Update();
+		// The byte on the line has left the transmit buffer
+		while (InFlight.size() > TxCapacity)
+		{
+			Clock.AdvanceTo(InFlight.front().Arrival);
+			Update();
+		}
+		uint64_t Start = LineFree > Clock.Nanos() ? LineFree : Clock.Nanos();
+		uint64_t Arrival = Start + FrameNanos();
+		LineFree = Arrival + GapNanos;
+		InFlight.push_back(Frame{ Arrival, Byte });
+	}
+
+	size_t SerialWire::TxFree()
+	{
+		Update();
+		return InFlight.size() > TxCapacity ? 0 : TxCapacity + 1 - InFlight.size();
+	}
+
+	bool SerialWire::InFlightEmpty()
+	{
+		Update();
+		return InFlight.empty();
+	}
+
+	size_t SerialWire::Available()
+	{
+		Update();
+		return Rx.size();
+	}
+
+	int SerialWire::Peek()
+	{
+		Update();
+		return Rx.empty() ? -1 : Rx.front();
+	}
+
+	int SerialWire::Receive()
+	{
+		Update();
+		if (Rx.empty())
+			return -1;
+		uint8_t Byte = Rx.front();
+		Rx.pop_front();
+		return Byte;
+	}
+
+	bool SerialWire::TakeOverflow()
+	{
+		Update();
+		bool Result = Overflowed;
+		Overflowed = false;
+		return Result;
+	}
+
+	void SerialWire::Clear()
+	{
+		InFlight.clear();
+		Rx.clear();
+		LineFree = Clock.Nanos();
+		Overflowed = false;
+	}
+
+	// * ----- SimulatedSerial ----------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Called when there is nothing to read. Lets the idle handler produce data if nothing is in flight, then lets the poll cost pass.
+	 */
+	void SimulatedSerial::Poll()
+	{
+		if (RxWire.InFlightEmpty())
+			RxWire.GetClock().Idle();
+		RxWire.GetClock().Advance(PollNanos);
+	}
+
+	void SimulatedSerial::begin(unsigned long Baud, uint8_t Config)
+	{
+		(void)Config;
+		RxWire.GetClock().Install();
+		RxWire.SetBaud(Baud);
+		TxWire.SetBaud(Baud);
+	}
+
+	void SimulatedSerial::end()
+	{
+		RxWire.Clear();
+	}
+
+	int SimulatedSerial::available()
+	{
+		int Result = RxWire.Available();
+		if (!Result)
+			Poll();
+		return Result;
+	}
+
+	int SimulatedSerial::availableForWrite()
+	{
+		return TxWire.TxFree();
+	}
+
+	int SimulatedSerial::peek()
+	{
+		return RxWire.Peek();
+	}
+
+	int SimulatedSerial::read()
+	{
+		return RxWire.Receive();
+	}
+
+	size_t SimulatedSerial::write(uint8_t Byte)
+	{
+		TxWire.Send(Byte);
+		return 1;
+	}
+
+	size_t SimulatedSerial::write(const uint8_t* Data, size_t Length)
+	{
+		for (size_t C = 0; C < Length; C++)
+			TxWire.Send(Data[C]);
+		return Length;
+	}
+
+	bool SimulatedSerial::overflow()
+	{
+		return RxWire.TakeOverflow();
+	}
+
+}
+
+#endif
@@ -0,0 +1,194 @@
+#pragma once
+#ifndef INO_SERIALSIMULATOR_INCLUDED
+#define INO_SERIALSIMULATOR_INCLUDED
+
+#include "InoCore.h"
+
+#ifdef INO_HOST
+
+#include "Clock.h"
+
+#include <deque>
+#include <functional>
+
+#ifndef SERIAL_8N1
+#define SERIAL_8N1 0x06
+#endif
+
+#ifndef INO_SERIALSIMULATOR_BUFFERSIZE
+#define INO_SERIALSIMULATOR_BUFFERSIZE 64
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Simulated time in nanoseconds (host only). Time only passes when something advances the clock, so simulations are deterministic.
+	 */
+	class VirtualClock
+	{
+	private:
+		uint64_t Time = 0;
+		std::function<bool()> IdleHandler;
+
+	public:
+		VirtualClock() {}
+		~VirtualClock();
+		VirtualClock(const VirtualClock&) = delete;
+		VirtualClock& operator=(const VirtualClock&) = delete;
+
+		// Makes this clock the time source of the library (ino::Clock), ino::SimulatedSerial::begin() does it for the clock of its wires
+		void Install();
+		inline uint64_t Nanos() const { return Time; }
+		inline unsigned long Micros() const { return static_cast<unsigned long>(Time / 1000); }
+		inline unsigned long Millis() const { return static_cast<unsigned long>(Time / 1000000); }
+
+		inline void Advance(uint64_t Delta) { Time += Delta; }
+		inline void AdvanceTo(uint64_t Target) { if (Target > Time) Time = Target; }
+		inline void Reset() { Time = 0; }
+
+		/**
+		 * @brief Sets a function that is called whenever a simulated device waits with nothing in flight, ex. to send the next test message. It returns false, when it has nothing to do.
+		 */
+		inline void SetIdleHandler(const std::function<bool()>& Handler) { IdleHandler = Handler; }
+		inline bool Idle() { return IdleHandler && IdleHandler(); }
+	};
+
+	/**
+	 * @brief Clock used by ino::micros(), ino::millis(), ino::delay() and ino::delayMicroseconds() on host, and by ino::Clock once a simulated port is begun.
+	 */
+	extern VirtualClock SimulationClock;
+
+	// Inside namespace ino these hide the Arduino functions of the same name, so the streams of this library run on simulated time on host
+	inline unsigned long micros() { return SimulationClock.Micros(); }
+	inline unsigned long millis() { return SimulationClock.Millis(); }
+	inline void delayMicroseconds(unsigned int Micros) { SimulationClock.Advance(static_cast<uint64_t>(Micros) * 1000); }
+	inline void delay(unsigned long Millis) { SimulationClock.Advance(static_cast<uint64_t>(Millis) * 1000000); }
+
+	/**
+	 * @brief Interface of a serial port on host, takes the place of `HardwareSerial` and `SoftwareSerial` (see ino::SerialStream and ino::PinStream).
+	 */
+	class SerialPort
+	{
+	public:
+		virtual ~SerialPort() {}
+
+		virtual void begin(unsigned long Baud, uint8_t Config = SERIAL_8N1) = 0;
+		virtual void end() = 0;
+		virtual int available() = 0;
+		virtual int availableForWrite() = 0;
+		virtual int peek() = 0;
+		virtual int read() = 0;
+		virtual size_t write(uint8_t Byte) = 0;
+		virtual size_t write(const uint8_t* Data, size_t Length) = 0;
+		virtual bool overflow() = 0;
+	};
+
+	/**
+	 * @brief One direction of a simulated serial connection.
+	 * @details
+	 * 	Every byte occupies the line for one frame (`FrameBits` bit times at the baud rate) plus an optional gap. A byte arrives in the receive buffer when its frame is complete, if the receive buffer is full the byte is lost and the overflow flag is set.
+	 * 	Sending blocks, advancing the clock, while the transmit buffer is full, like `HardwareSerial::write()`.
+	 */
+	class SerialWire
+	{
+	private:
+		struct Frame
+		{
+			uint64_t Arrival;
+			uint8_t Byte;
+		};
+
+		VirtualClock& Clock;
+		unsigned long Baud = 9600;
+		uint8_t FrameBits = 10;
+		uint64_t GapNanos = 0;
+		size_t TxCapacity;
+		size_t RxCapacity;
+		uint64_t LineFree = 0;
+		std::deque<Frame> InFlight;
+		std::deque<uint8_t> Rx;
+		bool Overflowed = false;
+		size_t Dropped = 0;
+		size_t Delivered = 0;
+
+	public:
+		SerialWire(VirtualClock& Clock = SimulationClock, size_t TxCapacity = INO_SERIALSIMULATOR_BUFFERSIZE, size_t RxCapacity = INO_SERIALSIMULATOR_BUFFERSIZE) : Clock(Clock), TxCapacity(TxCapacity), RxCapacity(RxCapacity) {}
+
+		inline void SetBaud(unsigned long NewBaud) { Baud = NewBaud; }
+		inline void SetFrameBits(uint8_t NewFrameBits) { FrameBits = NewFrameBits; }
+		inline void SetGap(uint64_t NewGapNanos) { GapNanos = NewGapNanos; }
+		inline unsigned long GetBaud() const { return Baud; }
+		inline uint64_t FrameNanos() const { return static_cast<uint64_t>(FrameBits) * 1000000000ULL / Baud; }
+		inline VirtualClock& GetClock() const { return Clock; }
+
+		void Update();
+		void Send(uint8_t Byte);
+		size_t TxFree();
+		bool InFlightEmpty();
+
+		size_t Available();
+		int Peek();
+		int Receive();
+		bool TakeOverflow();
+		void Clear();
+
+		inline size_t DroppedBytes() const { return Dropped; }
+		inline size_t DeliveredBytes() const { return Delivered; }
+	};
+
+	/**
+	 * @brief Simulated serial port, one end of a connection made of two ino::SerialWire. Polling `available()` without data costs `PollNanos` of simulated time, so busy waiting loops make progress deterministically.
+	 */
+	class SimulatedSerial : public SerialPort
+	{
+	private:
+		SerialWire& RxWire;
+		SerialWire& TxWire;
+		uint64_t PollNanos = 1000;
+
+		void Poll();
+
+	public:
+		SimulatedSerial(SerialWire& RxWire, SerialWire& TxWire) : RxWire(RxWire), TxWire(TxWire) {}
+
+		inline void SetPollCost(uint64_t NewPollNanos) { PollNanos = NewPollNanos; }
+		inline SerialWire& GetRxWire() { return RxWire; }
+		inline SerialWire& GetTxWire() { return TxWire; }
+
+		virtual void begin(unsigned long Baud, uint8_t Config = SERIAL_8N1) override;
+		virtual void end() override;
+		virtual int available() override;
+		virtual int availableForWrite() override;
+		virtual int peek() override;
+		virtual int read() override;
+		virtual size_t write(uint8_t Byte) override;
+		virtual size_t write(const uint8_t* Data, size_t Length) override;
+		virtual bool overflow() override;
+	};
+
+	/**
+	 * @brief Two simulated serial ports `A` and `B` connected to each other.
+	 *
+	 * 	Ex.
+	 * 	`ino::SerialLoopback Link; ino::SerialOutStream Device(Link.A); ino::SerialInStream Host(Link.B);`
+	 * 	`Device.begin(115200); Host.begin(115200); Device << 42 << ino::endl; Host >> Value;`
+	 */
+	class SerialLoopback
+	{
+	public:
+		SerialWire AToB;
+		SerialWire BToA;
+		SimulatedSerial A;
+		SimulatedSerial B;
+
+		SerialLoopback(VirtualClock& Clock = SimulationClock, size_t BufferSize = INO_SERIALSIMULATOR_BUFFERSIZE) : AToB(Clock, BufferSize, BufferSize), BToA(Clock, BufferSize, BufferSize), A(BToA, AToB), B(AToB, BToA) {}
+
+		SerialLoopback(const SerialLoopback&) = delete;
+		SerialLoopback& operator=(const SerialLoopback&) = delete;
+	};
+
+}
+
+#endif
+
+#endif
@@ -4,18 +4,29 @@
 
 #include "InoCore.h"
 
+#ifdef INO_HOST
+#include "SerialSimulator.h"
+#else
 #include <Arduino.h>
+#endif
 
 namespace ino {
 
 	class SerialStream
 	{
+	public:
+#ifdef INO_HOST
+		using SerialType = SerialPort;
+#else
+		using SerialType = HardwareSerial;
+#endif
+
 	protected:
-		HardwareSerial& SerialRef;
+		SerialType& SerialRef;
 		unsigned long SerialBaud;
 
 	public:
-		SerialStream(HardwareSerial& SerialRef) : SerialRef(SerialRef) {}
+		SerialStream(SerialType& SerialRef) : SerialRef(SerialRef) {}
 
     	virtual void begin(unsigned long SerialBaud, uint8_t Config = SERIAL_8N1) { SerialRef.begin(SerialBaud, Config); this->SerialBaud = SerialBaud; }
     	virtual void end() { SerialRef.end(); }
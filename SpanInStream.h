@@ -0,0 +1,41 @@
+#pragma once
+#ifndef INO_SPANINSTREAM_INCLUDED
+#define INO_SPANINSTREAM_INCLUDED
+
+#include "InoCore.h"
+#include "InStream.h"
+
+namespace ino {
+
+	class SpanInStream : public InStream
+	{
+	private:
+		const char* Data;
+		size_t Size;
+
+	public:
+		SpanInStream(const char* Data, size_t Size) : Data(Data), Size(Size) {}
+
+		inline const char* PeekSpan() const { return Data; }
+		inline size_t SpanSize() const { return Size; }
+		inline void Advance(size_t Count) { if (Count > Size) Count = Size; Data += Count; Size -= Count; }
+
+		virtual inline char Peek() const override { return Size ? *Data : '\0'; }
+		virtual inline unsigned int Available() const override { return Size > static_cast<unsigned int>(-1) ? static_cast<unsigned int>(-1) : static_cast<unsigned int>(Size); }
+		virtual inline char Read() override { if (!Size) return '\0'; Size--; return *Data++; }
+
+	protected:
+		virtual inline void SkipBuffered(char StopA, char StopB, char StopC) override
+		{
+			size_t Count = 0;
+			while (Count < Size && Data[Count] != StopA && Data[Count] != StopB && Data[Count] != StopC)
+				Count++;
+			Advance(Count);
+			AddSkipped(Count);
+		}
+
+	};
+
+}
+
+#endif
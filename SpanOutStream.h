@@ -0,0 +1,57 @@
+#pragma once
+#ifndef INO_SPANOUTSTREAM_INCLUDED
+#define INO_SPANOUTSTREAM_INCLUDED
+
+#include "InoCore.h"
+#include "OutStream.h"
+
+#include <string.h>
+
+namespace ino {
+
+	/**
+	 * @brief Output stream into a fixed buffer. Characters that do not fit are dropped and remembered by Overflowed().
+	 */
+	class SpanOutStream : public OutStream
+	{
+	private:
+		char* Data;
+		size_t Size;
+		size_t Length = 0;
+		bool Overflow = false;
+
+	protected:
+		virtual inline void Write(char Character) override
+		{
+			if (Length < Size)
+				Data[Length++] = Character;
+			else
+				Overflow = true;
+		}
+		virtual inline void WriteBlock(const char* Block, unsigned int BlockLength) override
+		{
+			if (BlockLength > Size - Length)
+			{
+				BlockLength = Size - Length;
+				Overflow = true;
+			}
+			memcpy(Data + Length, Block, BlockLength);
+			Length += BlockLength;
+		}
+
+	public:
+		SpanOutStream(char* Data, size_t Size) : Data(Data), Size(Size) {}
+
+		inline char* GetSpan() const { return Data; }
+		inline size_t SpanSize() const { return Size; }
+		inline size_t GetLength() const { return Length; }
+		inline bool Overflowed() const { return Overflow; }
+
+		inline void Rewind(size_t NewLength) { if (NewLength < Length) Length = NewLength; Overflow = false; }
+		inline void Clear() { Length = 0; Overflow = false; }
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+#ifndef INO_SPSCRING_INCLUDED
+#define INO_SPSCRING_INCLUDED
+
+#include "InoCore.h"
+
+#include <string.h>
+
+#ifdef __AVR__
+#include <util/atomic.h>
+#else
+#include <atomic>
+#endif
+
+namespace ino {
+
+#ifdef __AVR__
+	/**
+	 * @brief Index shared between producer and consumer. Loads and stores of indices wider than one byte are done with interrupts disabled, the compiler barriers order the buffer accesses around them.
+	 */
+	template <typename T>
+	class RingIndex
+	{
+	private:
+		volatile T Value = 0;
+
+	public:
+		inline T Load() const
+		{
+			T Result;
+			if (sizeof(T) == 1)
+				Result = Value;
+			else
+			{
+				ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { Result = Value; }
+			}
+			asm volatile("" ::: "memory");
+			return Result;
+		}
+		inline void Store(T NewValue)
+		{
+			asm volatile("" ::: "memory");
+			if (sizeof(T) == 1)
+				Value = NewValue;
+			else
+			{
+				ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { Value = NewValue; }
+			}
+		}
+	};
+#else
+	/**
+	 * @brief Index shared between producer and consumer. Stores release the buffer accesses before them, loads acquire them.
+	 */
+	template <typename T>
+	class RingIndex
+	{
+	private:
+		std::atomic<T> Value{0};
+
+	public:
+		inline T Load() const { return Value.load(std::memory_order_acquire); }
+		inline void Store(T NewValue) { Value.store(NewValue, std::memory_order_release); }
+	};
+#endif
+
+	/**
+	 * @brief Lock-free ring buffer of `N` bytes for exactly one producer and one consumer (ex. an interrupt service routine and `loop()`).
+	 * @details
+	 * 	`N` must be a power of two. The indices run freely and are masked on access, so all `N` bytes can be used.
+	 * 	Only the producer may call Push() and Free(), only the consumer may call Pop(), Peek() and Available().
+	 */
+	template <size_t N>
+	class SpscRing
+	{
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "ino::SpscRing size must be a power of two");
+
+	public:
+		using IndexType = typename std::conditional<(N <= 128), uint8_t, typename std::conditional<(N <= 32768), uint16_t, size_t>::type>::type;
+
+	private:
+		static constexpr IndexType Mask = N - 1;
+
+		char Buffer[N];
+		RingIndex<IndexType> Head; // Written by the producer
+		RingIndex<IndexType> Tail; // Written by the consumer
+
+	public:
+		inline size_t Available() const { return static_cast<IndexType>(Head.Load() - Tail.Load()); }
+		inline size_t Free() const { return N - static_cast<IndexType>(Head.Load() - Tail.Load()); }
+		inline bool Empty() const { return Available() == 0; }
+
+		inline bool Push(char Character)
+		{
+			IndexType H = Head.Load();
+			if (static_cast<IndexType>(H - Tail.Load()) == N)
+				return false;
+			Buffer[H & Mask] = Character;
+			Head.Store(H + 1);
+			return true;
+		}
+
+		inline bool Pop(char& Character)
+		{
+			IndexType T = Tail.Load();
+			if (Head.Load() == T)
+				return false;
+			Character = Buffer[T & Mask];
+			Tail.Store(T + 1);
+			return true;
+		}
+
+		inline char Peek() const { return Buffer[Tail.Load() & Mask]; }
+
+		/**
+		 * @brief Pushes as many bytes of `Data` as there is space for, with at most two copies and a single index update.
+		 * @return Returns the number of bytes pushed.
+		 */
+		size_t Push(const char* Data, size_t Length)
+		{
+			IndexType H = Head.Load();
+			size_t Space = N - static_cast<IndexType>(H - Tail.Load());
+			if (Length > Space)
+				Length = Space;
+			size_t Start = H & Mask;
+			size_t First = Length < N - Start ? Length : N - Start;
+			memcpy(Buffer + Start, Data, First);
+			memcpy(Buffer, Data + First, Length - First);
+			Head.Store(H + Length);
+			return Length;
+		}
+
+		/**
+		 * @brief Pops up to `Length` bytes into `Data`, with at most two copies and a single index update.
+		 * @return Returns the number of bytes popped.
+		 */
+		size_t Pop(char* Data, size_t Length)
+		{
+			IndexType T = Tail.Load();
+			size_t Filled = static_cast<IndexType>(Head.Load() - T);
+			if (Length > Filled)
+				Length = Filled;
+			size_t Start = T & Mask;
+			size_t First = Length < N - Start ? Length : N - Start;
+			memcpy(Data, Buffer + Start, First);
+			memcpy(Data + First, Buffer, Length - First);
+			Tail.Store(T + Length);
+			return Length;
+		}
+
+	};
+
+}
+
+#endif
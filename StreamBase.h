@@ -4,6 +4,7 @@
 
 #include "InoCore.h"
 #include "StreamFormat.h"
+#include "StreamTrace.h"
 
 namespace ino {
 
@@ -21,9 +22,42 @@ namespace ino {
 		inline void SetEnd(char NewTransferEnd) { TransferEnd = NewTransferEnd; }
 		inline void NoEnd() { TransferEnd = -1; }
 		inline char GetEnd() const { return TransferEnd; }
+
+#ifdef INO_STREAMTRACE
+	protected:
+		StreamTracer* Tracer = nullptr;
+
+		inline void TraceTransfer() const { if (Tracer) Tracer->Trace(*this, TraceEvent::Transfer); }
+
+	public:
+		inline void SetTracer(StreamTracer* NewTracer) { Tracer = NewTracer; }
+		inline StreamTracer* GetTracer() const { return Tracer; }
+
+		friend class StreamTraceScope;
+#endif
 		
     };
 
+#ifdef INO_STREAMTRACE
+	/**
+	 * @brief Sends ino::TraceEvent::OperatorBegin and ino::TraceEvent::OperatorEnd for its lifetime, see INO_STREAMTRACE_OPERATOR().
+	 */
+	class StreamTraceScope
+	{
+	private:
+		const StreamBase& Stream;
+
+	public:
+		inline StreamTraceScope(const StreamBase& Stream) : Stream(Stream) { if (Stream.Tracer) Stream.Tracer->Trace(Stream, TraceEvent::OperatorBegin); }
+		inline ~StreamTraceScope() { if (Stream.Tracer) Stream.Tracer->Trace(Stream, TraceEvent::OperatorEnd); }
+	};
+
+	// First statement of every input and output operator
+#define INO_STREAMTRACE_OPERATOR() ::ino::StreamTraceScope InoStreamTraceScope(*this)
+#else
+#define INO_STREAMTRACE_OPERATOR()
+#endif
+
 }
 
 #endif
@@ -0,0 +1,26 @@
+#include "InoCore.h"
+#include "StreamFormat.h"
+
+namespace ino {
+
+	namespace Fmt {
+		namespace Flash {
+			const char BoolWordTrue[] PROGMEM = "true";
+			const char BoolWordFalse[] PROGMEM = "false";
+			const char BoolCapitalTrue[] PROGMEM = "True";
+			const char BoolCapitalFalse[] PROGMEM = "False";
+			const char BoolCapsTrue[] PROGMEM = "TRUE";
+			const char BoolCapsFalse[] PROGMEM = "FALSE";
+			const char BoolNumTrue[] PROGMEM = "1";
+			const char BoolNumFalse[] PROGMEM = "0";
+
+			const char SpecialnumberShortNan[] PROGMEM = "nan";
+			const char SpecialnumberShortPosInf[] PROGMEM = "inf+";
+			const char SpecialnumberShortNegInf[] PROGMEM = "inf-";
+			const char SpecialnumberLongNan[] PROGMEM = "not-a-number";
+			const char SpecialnumberLongPosInf[] PROGMEM = "positive-infinity";
+			const char SpecialnumberLongNegInf[] PROGMEM = "negative-infinity";
+		}
+	}
+
+}
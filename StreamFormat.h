@@ -4,6 +4,7 @@
 
 #include "InoCore.h"
 #include "Packed.h"
+#include "FlashString.h"
 
 #include <inttypes.h>
 
@@ -83,15 +84,27 @@ namespace ino {
     struct BoolFormats {
         const char* BoolTrue;
         const char* BoolFalse;
+        bool InFlash; // The strings are in program memory (PROGMEM), like the predefined formats
 
-        constexpr inline BoolFormats(const char* BoolTrue, const char* BoolFalse) : BoolTrue(BoolTrue), BoolFalse(BoolFalse) {}
+        constexpr inline BoolFormats(const char* BoolTrue, const char* BoolFalse, bool InFlash = false) : BoolTrue(BoolTrue), BoolFalse(BoolFalse), InFlash(InFlash) {}
     };
 
     namespace Fmt {
-        constexpr BoolFormats BoolWord = { "true", "false" };
-        constexpr BoolFormats BoolCapital = { "True", "False" };
-        constexpr BoolFormats BoolCaps = { "TRUE", "FALSE" };
-        constexpr BoolFormats BoolNum = { "1", "0" };
+        namespace Flash { // Strings of the predefined formats (StreamFormat.cpp)
+            extern const char BoolWordTrue[] PROGMEM;
+            extern const char BoolWordFalse[] PROGMEM;
+            extern const char BoolCapitalTrue[] PROGMEM;
+            extern const char BoolCapitalFalse[] PROGMEM;
+            extern const char BoolCapsTrue[] PROGMEM;
+            extern const char BoolCapsFalse[] PROGMEM;
+            extern const char BoolNumTrue[] PROGMEM;
+            extern const char BoolNumFalse[] PROGMEM;
+        }
+
+        constexpr BoolFormats BoolWord = { Flash::BoolWordTrue, Flash::BoolWordFalse, true };
+        constexpr BoolFormats BoolCapital = { Flash::BoolCapitalTrue, Flash::BoolCapitalFalse, true };
+        constexpr BoolFormats BoolCaps = { Flash::BoolCapsTrue, Flash::BoolCapsFalse, true };
+        constexpr BoolFormats BoolNum = { Flash::BoolNumTrue, Flash::BoolNumFalse, true };
     }
 
 	template <typename T>
@@ -166,13 +179,23 @@ namespace ino {
 		const char* Nan;
 		const char* PosInf;
 		const char* NegInf;
+		bool InFlash; // The strings are in program memory (PROGMEM), like the predefined formats
 
-		constexpr inline SpecialnumberFormats(const char* Nan, const char* PosInf, const char* NegInf) : Nan(Nan), PosInf(PosInf), NegInf(NegInf) {}
+		constexpr inline SpecialnumberFormats(const char* Nan, const char* PosInf, const char* NegInf, bool InFlash = false) : Nan(Nan), PosInf(PosInf), NegInf(NegInf), InFlash(InFlash) {}
 	};
 
 	namespace Fmt {
-		constexpr SpecialnumberFormats SpecialnumberShort = { "nan", "inf+", "inf-" };
-		constexpr SpecialnumberFormats SpecialnumberLong = { "not-a-number", "positive-infinity", "negative-infinity" };
+		namespace Flash { // Strings of the predefined formats (StreamFormat.cpp)
+			extern const char SpecialnumberShortNan[] PROGMEM;
+			extern const char SpecialnumberShortPosInf[] PROGMEM;
+			extern const char SpecialnumberShortNegInf[] PROGMEM;
+			extern const char SpecialnumberLongNan[] PROGMEM;
+			extern const char SpecialnumberLongPosInf[] PROGMEM;
+			extern const char SpecialnumberLongNegInf[] PROGMEM;
+		}
+
+		constexpr SpecialnumberFormats SpecialnumberShort = { Flash::SpecialnumberShortNan, Flash::SpecialnumberShortPosInf, Flash::SpecialnumberShortNegInf, true };
+		constexpr SpecialnumberFormats SpecialnumberLong = { Flash::SpecialnumberLongNan, Flash::SpecialnumberLongPosInf, Flash::SpecialnumberLongNegInf, true };
 	}
 
 	template <typename T>
@@ -210,6 +233,32 @@ namespace ino {
 		return Pack(std::forward<T>(Var), CString);
 	}
 
+	//SeparatorFormats
+
+	struct SeparatorFormats {
+		const char* SeparatorVal;
+		char SeparatorChar;
+
+		constexpr inline SeparatorFormats(const char* SeparatorVal) : SeparatorVal(SeparatorVal), SeparatorChar(SeparatorVal[0]) {}
+		constexpr inline SeparatorFormats(char SeparatorChar) : SeparatorVal(nullptr), SeparatorChar(SeparatorChar) {}
+	};
+
+	namespace Fmt {
+		constexpr SeparatorFormats SepComma = ", ";
+		constexpr SeparatorFormats SepSpace = ' ';
+	}
+
+	constexpr inline SeparatorFormats Sep(const char* Separator) {
+		return Separator;
+	}
+
+	constexpr inline SeparatorFormats Sep(char Separator) {
+		return Separator;
+	}
+
+	template <typename T, typename... FmtTs>
+	struct RangeFormat;
+
 	//Multiple formats
 
 	template <typename VarT, typename... FmtTs>
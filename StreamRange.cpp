@@ -0,0 +1,39 @@
+#include "InoCore.h"
+#include "StreamRange.h"
+
+namespace ino {
+
+	/**
+	 * @brief Converts `Data` to decimal digits that end right before `End` (at most 10 characters, not terminated).
+	 * @return Returns the number of digits written.
+	 */
+	uint8_t FormatDecimal(char* End, uint32_t Data)
+	{
+		char* Digit = End;
+		do
+		{
+			*--Digit = '0' + Data % 10;
+			Data /= 10;
+		} while (Data);
+		return End - Digit;
+	}
+
+	/**
+	 * @brief Converts `Data` to decimal digits that end right before `End` (at most 20 characters, not terminated). Values that fit into 32 bit avoid 64 bit divisions.
+	 * @return Returns the number of digits written.
+	 */
+	uint8_t FormatDecimal(char* End, uint64_t Data)
+	{
+		if (Data <= 0xFFFFFFFFULL)
+			return FormatDecimal(End, static_cast<uint32_t>(Data));
+
+		char* Digit = End;
+		do
+		{
+			*--Digit = '0' + Data % 10;
+			Data /= 10;
+		} while (Data);
+		return End - Digit;
+	}
+
+}
@@ -0,0 +1,271 @@
+#pragma once
+#ifndef INO_STREAMRANGE_INCLUDED
+#define INO_STREAMRANGE_INCLUDED
+
+#include "InoCore.h"
+#include "StreamFormat.h"
+#include "OutStream.h"
+#include "InStream.h"
+#include "SpanOutStream.h"
+
+#include <string.h>
+
+#ifndef INO_RANGE_BUFFERSIZE
+#define INO_RANGE_BUFFERSIZE 64
+#endif
+
+namespace ino {
+
+	/**
+	 * @brief Holds the formats applied to every element of a range and passes them on as parameter pack.
+	 */
+	template <typename... FmtTs>
+	struct FormatList;
+
+	template <>
+	struct FormatList<>
+	{
+		constexpr inline FormatList() {}
+
+		template <typename ActionT, typename ElementT, typename... CollectedTs>
+		inline void Apply(ActionT& Action, ElementT& Element, const CollectedTs&... Collected) const { Action(Element, Collected...); }
+	};
+
+	template <typename FmtT, typename... FmtTs>
+	struct FormatList<FmtT, FmtTs...>
+	{
+		FmtT Head;
+		FormatList<FmtTs...> Tail;
+
+		constexpr inline FormatList(const FmtT& Head, const FmtTs&... Tail) : Head(Head), Tail(Tail...) {}
+
+		template <typename ActionT, typename ElementT, typename... CollectedTs>
+		inline void Apply(ActionT& Action, ElementT& Element, const CollectedTs&... Collected) const { Tail.Apply(Action, Element, Collected..., Head); }
+	};
+
+	template <typename T, typename... FmtTs>
+	struct RangeFormat
+	{
+		T* Var;
+		size_t Size;
+		SeparatorFormats Separator;
+		FormatList<FmtTs...> Formats;
+		mutable size_t Count = 0; // Number of elements read by the last input operation
+		mutable size_t FailIndex = static_cast<size_t>(-1); // Index of the element that failed in the last input operation
+
+		constexpr inline RangeFormat(T* Var, size_t Size, const SeparatorFormats& Separator, const FmtTs&... Formats) : Var(Var), Size(Size), Separator(Separator), Formats(Formats...) {}
+	};
+
+	template <typename T, typename... FmtTs>
+	constexpr inline RangeFormat<T, FmtTs...> Range(T* Var, size_t Size, const SeparatorFormats& Separator = Fmt::SepComma, const FmtTs&... Formats) {
+		return RangeFormat<T, FmtTs...>(Var, Size, Separator, Formats...);
+	}
+
+	template <typename T, size_t N, typename... FmtTs>
+	constexpr inline RangeFormat<T, FmtTs...> Range(T (&Var)[N], const SeparatorFormats& Separator = Fmt::SepComma, const FmtTs&... Formats) {
+		return RangeFormat<T, FmtTs...>(Var, N, Separator, Formats...);
+	}
+
+	/**
+	 * @brief Range over a container with `data()` and `size()` (ex. `std::array`).
+	 */
+	template <typename ContainerT, typename... FmtTs>
+	constexpr inline auto Range(ContainerT& Var, const SeparatorFormats& Separator = Fmt::SepComma, const FmtTs&... Formats) -> RangeFormat<typename std::remove_pointer<decltype(Var.data())>::type, FmtTs...> {
+		return RangeFormat<typename std::remove_pointer<decltype(Var.data())>::type, FmtTs...>(Var.data(), Var.size(), Separator, Formats...);
+	}
+
+	uint8_t FormatDecimal(char* End, uint32_t Data);
+	uint8_t FormatDecimal(char* End, uint64_t Data);
+
+	/**
+	 * @brief Writes a single range element and the separator in front of it.
+	 * @details Integrals and floating point numbers without formats bypass the output operators. They are converted with FormatDecimal() or ino::OutStream::FloatBlock() and written together with the separator as one block.
+	 */
+	class RangeElementWriter
+	{
+	private:
+		constexpr static uint8_t SeparatorRoom = 11; // Separators up to this length are written in the block of the number
+
+		OutStream& Stream;
+		const char* Separator;
+		unsigned int SeparatorLength;
+
+		inline void WriteSeparator() { if (Separate) Stream.Put(Separator, SeparatorLength); }
+
+		// Puts the separator in front of the number that starts at `Begin` (at least SeparatorRoom characters after the block start) and writes both
+		inline void WriteBlock(char* Block, char* Begin, char* End)
+		{
+			if (Separate && SeparatorLength <= static_cast<unsigned int>(Begin - Block))
+			{
+				Begin -= SeparatorLength;
+				memcpy(Begin, Separator, SeparatorLength);
+			}
+			else
+				WriteSeparator();
+			Stream.Put(Begin, End - Begin);
+		}
+
+	public:
+		bool Separate = false; // Writes the separator in front of the next element
+
+		RangeElementWriter(OutStream& Stream, const char* Separator, unsigned int SeparatorLength) : Stream(Stream), Separator(Separator), SeparatorLength(SeparatorLength) {}
+
+		template <typename T, typename std::enable_if<std::is_integral<typename ReduceType<T>::type>::value && !std::is_same<bool, typename ReduceType<T>::type>::value && !std::is_same<char, typename ReduceType<T>::type>::value, int>::type = 0>
+		inline void operator()(T& Element)
+		{
+			using U = typename std::conditional<(sizeof(typename ReduceType<T>::type) > 4), uint64_t, uint32_t>::type;
+			char Block[SeparatorRoom + 21]; // Sign and up to 20 digits
+			char* End = Block + sizeof(Block);
+			U Magnitude = static_cast<U>(Element);
+			bool Negative = IsSigned<typename ReduceType<T>::type>::value && Element < 0;
+			if (Negative)
+				Magnitude = static_cast<U>(0) - Magnitude;
+			char* Begin = End - FormatDecimal(End, Magnitude);
+			if (Negative)
+				*--Begin = '-';
+			WriteBlock(Block, Begin, End);
+		}
+
+		template <typename T, typename std::enable_if<std::is_floating_point<typename ReduceType<T>::type>::value, int>::type = 0>
+		inline void operator()(T& Element)
+		{
+			char Block[SeparatorRoom + OutStream::FloatBlockSize];
+			uint8_t Length = OutStream::FloatBlock(Block + SeparatorRoom, static_cast<OutStream::FloatCoreType<typename ReduceType<T>::type>>(Element), Fmt::DecimalDot, OutStream::AutomaticPrecision);
+			if (Length)
+				WriteBlock(Block, Block + SeparatorRoom, Block + SeparatorRoom + Length);
+			else
+			{
+				WriteSeparator();
+				Stream << Element;
+			}
+		}
+
+		template <typename T, typename std::enable_if<!(std::is_integral<typename ReduceType<T>::type>::value && !std::is_same<bool, typename ReduceType<T>::type>::value && !std::is_same<char, typename ReduceType<T>::type>::value) && !std::is_floating_point<typename ReduceType<T>::type>::value, int>::type = 0>
+		inline void operator()(T& Element) { WriteSeparator(); Stream << Element; }
+
+		template <typename T, typename FmtT, typename... FmtTs>
+		inline void operator()(T& Element, const FmtT& Format, const FmtTs&... Formats) { WriteSeparator(); Stream << Pack(Element, Format, Formats...); }
+	};
+
+	/**
+	 * @brief Reads a single range element with the input operators of ino::InStream.
+	 */
+	class RangeElementReader
+	{
+	private:
+		InStream& Stream;
+
+	public:
+		RangeElementReader(InStream& Stream) : Stream(Stream) {}
+
+		template <typename T>
+		inline void operator()(T& Element) { Stream >> Element; }
+
+		template <typename T, typename FmtT, typename... FmtTs>
+		inline void operator()(T& Element, const FmtT& Format, const FmtTs&... Formats) { Stream >> Pack(Element, Format, Formats...); }
+	};
+
+	/**
+	 * @brief Range output operator. Prints the elements separated by the separator, applying the formats to every element.
+	 * @details
+	 * 	The elements are formatted into a staging buffer of `INO_RANGE_BUFFERSIZE` characters on the stack, which is written in blocks with ino::OutStream::Put().
+	 * 	The transfer is finished once for the whole range, not per element.
+	 */
+	template <typename T, typename... FmtTs>
+	OutStream& OutStream::operator<<(const RangeFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
+		const char* Separator = Data.Separator.SeparatorVal ? Data.Separator.SeparatorVal : &Data.Separator.SeparatorChar;
+		unsigned int SeparatorLength = Data.Separator.SeparatorVal ? strlen(Data.Separator.SeparatorVal) : 1;
+
+		char Buffer[INO_RANGE_BUFFERSIZE];
+		SpanOutStream Staging(Buffer, INO_RANGE_BUFFERSIZE);
+		RangeElementWriter Writer(Staging, Separator, SeparatorLength);
+		size_t Longest = 0; // Longest element (with separator) so far, the buffer is written out early when such an element would not fit anymore
+		for (size_t C = 0; C < Data.Size; C++)
+		{
+			size_t Mark = Staging.GetLength();
+			if (Mark && INO_RANGE_BUFFERSIZE - Mark < Longest)
+			{
+				InternalWriteBlock(Buffer, Mark);
+				Staging.Clear();
+				Mark = 0;
+			}
+			Writer.Separate = C != 0;
+			Data.Formats.Apply(Writer, Data.Var[C]);
+			if (!Staging.Overflowed())
+			{
+				if (Staging.GetLength() - Mark > Longest)
+					Longest = Staging.GetLength() - Mark;
+				continue;
+			}
+
+			InternalWriteBlock(Buffer, Mark);
+			Staging.Clear();
+			Data.Formats.Apply(Writer, Data.Var[C]);
+			if (Staging.Overflowed())
+			{
+				// Element does not even fit into an empty buffer
+				Staging.Clear();
+				char End = TransferEnd;
+				NoEnd();
+				RangeElementWriter Direct(*this, Separator, SeparatorLength);
+				Direct.Separate = C != 0;
+				Data.Formats.Apply(Direct, Data.Var[C]);
+				SetEnd(End);
+			}
+		}
+		InternalWriteBlock(Buffer, Staging.GetLength());
+		FinishTransfer();
+		return *this;
+	}
+
+	/**
+	 * @brief Range input operator. Reads a list of up to `Size` elements separated by the separator character from a single transfer.
+	 * @details
+	 * 	Blanks in front of elements are skipped, so a list printed with `ino::Sep(", ")` can be read with `ino::Sep(',')`.
+	 * 	Reading stops at the first malformed element. ino::RangeFormat::Count holds the number of elements read and ino::RangeFormat::FailIndex the index of the malformed element.
+	 * 	Empty elements and more elements than `Size` set the fail flag ino::InStream::Fails::WrongFormat. The rest of the transfer is discarded after a failure, fail flags and the transfer are handled once for the whole list.
+	 * 	Ex. `auto Table = ino::Range(Buffer, 256, ino::Sep(',')); ino::in >> Table;`
+	 */
+	template <typename T, typename... FmtTs, typename std::enable_if<(std::is_integral<T>::value || std::is_floating_point<T>::value) && !std::is_same<bool, typename std::remove_cv<T>::type>::value && !std::is_same<char, typename std::remove_cv<T>::type>::value && !std::is_const<T>::value, int>::type>
+	InStream& InStream::operator>>(const RangeFormat<T, FmtTs...>& Data) {
+		INO_STREAMTRACE_OPERATOR();
+		Data.Count = 0;
+		Data.FailIndex = static_cast<size_t>(-1);
+		Fails PreviousFails = FailFlags;
+		FailFlags = Fails::NoFail;
+		ElementEnd = Data.Separator.SeparatorChar;
+		unsigned long Timeout = CallTimeout;
+
+		RangeElementReader Reader(*this);
+		bool Overflow = false;
+		while (NextRangeElement(Data.Count == 0))
+		{
+			if (Data.Count == Data.Size)
+			{
+				Overflow = true;
+				ParseFailed(Fails::WrongFormat, ParseError::Operators::Range, ParseError::Tokens::Element);
+				break;
+			}
+			Data.Formats.Apply(Reader, Data.Var[Data.Count]);
+			FirstRead = false; // The element operators finish the transfer, but the list is not finished yet
+			CallTimeout = Timeout;
+			if (Failed())
+				break;
+			Data.Count++;
+		}
+		if (Failed())
+			Data.FailIndex = Data.Count;
+
+		bool Pending = Overflow || (Available() && Peek() == ElementEnd);
+		ElementEnd = -1;
+		if (Pending)
+			ClearAndBreak();
+		FailFlags = static_cast<Fails>(static_cast<typename std::underlying_type<Fails>::type>(FailFlags) | static_cast<typename std::underlying_type<Fails>::type>(PreviousFails)); // Not SetFailFlag, the previous fails were counted already
+		FinishTransfer();
+		return *this;
+	}
+
+}
+
+#endif
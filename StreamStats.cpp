@@ -0,0 +1,58 @@
+#include "InoCore.h"
+#include "StreamStats.h"
+#include "ParseError.h"
+#include "OutStream.h"
+#include "InStream.h"
+
+namespace ino {
+
+	namespace {
+
+		void WriteCommon(OutStream& Stream, uint32_t Transfers, uint32_t BlockedMicros, uint16_t PeakOccupancy)
+		{
+			Stream << F(" B, ") << Transfers << F(" transfers, blocked ") << BlockedMicros << F(" us, peak ") << PeakOccupancy;
+		}
+
+	}
+
+	/**
+	 * @brief Prints the counters as a single transfer, ex. `written 1234 B, 56 transfers, blocked 789 us, peak 12`.
+	 */
+	OutStream& operator<<(OutStream& Stream, const OutStreamStats& Stats)
+	{
+		OutStream::Transfer Scope(Stream);
+		Stream << F("written ") << Stats.Bytes;
+		WriteCommon(Stream, Stats.Transfers, Stats.BlockedMicros, Stats.PeakOccupancy);
+		return Stream;
+	}
+
+	/**
+	 * @brief Prints the counters as a single transfer, ex. `read 1234 B, 56 transfers, blocked 789 us, peak 12, fails NotANumber 2 NoData 1`.
+	 * @details Only fail flags that were set at least once are listed.
+	 */
+	OutStream& operator<<(OutStream& Stream, const InStreamStats& Stats)
+	{
+		OutStream::Transfer Scope(Stream);
+		Stream << F("read ") << Stats.Bytes;
+		WriteCommon(Stream, Stats.Transfers, Stats.BlockedMicros, Stats.PeakOccupancy);
+		Stream << F(", fails");
+		bool Any = false;
+		for (uint8_t Bit = 0; Bit < sizeof(Stats.FailCounts) / sizeof(Stats.FailCounts[0]); Bit++)
+		{
+			if (!Stats.FailCounts[Bit])
+				continue;
+			Stream.Put(' ');
+			const __FlashStringHelper* Name = FailName(Bit);
+			if (Name)
+				Stream << Name;
+			else
+				Stream << F("bit") << Bit;
+			Stream.Put(' ') << Stats.FailCounts[Bit];
+			Any = true;
+		}
+		if (!Any)
+			Stream << F(" none");
+		return Stream;
+	}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef INO_STREAMSTATS_INCLUDED
+#define INO_STREAMSTATS_INCLUDED
+
+#include "InoCore.h"
+#include "Clock.h"
+
+#include <Arduino.h>
+
+#ifdef INO_STREAMSTATS
+#ifndef INO_STREAMSTATS_MICROS
+#define INO_STREAMSTATS_MICROS() ::ino::Clock::Micros()
+#endif
+#endif
+
+namespace ino {
+
+	class OutStream;
+
+	/**
+	 * @brief Counters of an ino::OutStream, see ino::OutStream::GetStats (only available when INO_STREAMSTATS is defined).
+	 */
+	struct OutStreamStats
+	{
+		uint32_t Bytes = 0;				// Characters written
+		uint32_t Transfers = 0;			// Finished transfers, one per output operator
+		uint32_t BlockedMicros = 0;		// Time spent waiting for the underlaying stream, reported by streams that can detect it (ex. ino::SerialOutStream, ino::FdOutStream)
+		uint16_t PeakOccupancy = 0;		// Highest number of characters waiting in the buffer of the stream, reported by buffered streams (ex. ino::FdOutStream)
+	};
+
+	/**
+	 * @brief Counters of an ino::InStream, see ino::InStream::GetStats (only available when INO_STREAMSTATS is defined).
+	 */
+	struct InStreamStats
+	{
+		uint32_t Bytes = 0;				// Characters read by the input operators
+		uint32_t Transfers = 0;			// Finished transfers, one per input operator (and per element of ino::Range)
+		uint32_t BlockedMicros = 0;		// Time spent in ino::InStream::NoDataAvailable
+		uint16_t PeakOccupancy = 0;		// Highest ino::InStream::Available seen when reading
+		uint16_t FailCounts[16] = {};	// How often each fail flag was set, indexed by the bit of ino::InStream::Fails
+	};
+
+	OutStream& operator<<(OutStream& Stream, const OutStreamStats& Stats);
+	OutStream& operator<<(OutStream& Stream, const InStreamStats& Stats);
+
+}
+
+#endif
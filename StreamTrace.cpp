@@ -0,0 +1,105 @@
+#include "InoCore.h"
+#include "StreamTrace.h"
+#include "OutStream.h"
+
+namespace ino {
+
+	// * ----- LatencyHistogram ---------------------------------------------------------------------------------------------------
+
+	void LatencyHistogram::Record(uint32_t Micros)
+	{
+		uint8_t Index = 0;
+		for (uint32_t Rest = Micros; Rest && Index < BucketCount - 1; Rest >>= 1)
+			Index++;
+		Buckets[Index]++;
+		Count++;
+		if (Micros > Max)
+			Max = Micros;
+	}
+
+	void LatencyHistogram::Clear()
+	{
+		for (uint8_t Index = 0; Index < BucketCount; Index++)
+			Buckets[Index] = 0;
+		Count = 0;
+		Max = 0;
+	}
+
+	/**
+	 * @brief Smallest duration counted by the bucket.
+	 */
+	uint32_t LatencyHistogram::BucketFrom(uint8_t Index)
+	{
+		return Index ? static_cast<uint32_t>(1) << (Index - 1) : 0;
+	}
+
+	/**
+	 * @brief Largest duration counted by the bucket, for the last bucket the largest recorded duration.
+	 */
+	uint32_t LatencyHistogram::BucketTo(uint8_t Index) const
+	{
+		if (Index == BucketCount - 1)
+			return Max > BucketFrom(Index) ? Max : BucketFrom(Index);
+		return (static_cast<uint32_t>(1) << Index) - 1;
+	}
+
+	/**
+	 * @brief Upper estimate of the percentile: the upper end of the bucket that contains it, but at most the largest recorded duration.
+	 * @return Returns `0` if nothing was recorded.
+	 */
+	uint32_t LatencyHistogram::Percentile(uint8_t Percent) const
+	{
+		uint32_t Target = static_cast<uint32_t>((static_cast<uint64_t>(Count) * Percent + 99) / 100);
+		uint32_t Seen = 0;
+		for (uint8_t Index = 0; Index < BucketCount; Index++)
+		{
+			Seen += Buckets[Index];
+			if (Seen && Seen >= Target)
+			{
+				uint32_t To = BucketTo(Index);
+				return To < Max ? To : Max;
+			}
+		}
+		return Max;
+	}
+
+	/**
+	 * @brief Prints the histogram as a single transfer, ex.
+	 * 	# count 1000, p50 15 us, p90 31 us, p99 63 us, max 80 us
+	 * 	# from_us	to_us	count
+	 * 	0	0	0
+	 * 	1	1	12
+	 * 	...
+	 * @details Buckets behind the last nonempty bucket are left out.
+	 */
+	OutStream& operator<<(OutStream& Stream, const LatencyHistogram& Histogram)
+	{
+		OutStream::Transfer Scope(Stream);
+		Stream << F("# count ") << Histogram.GetCount() << F(", p50 ") << Histogram.Percentile(50) << F(" us, p90 ") << Histogram.Percentile(90)
+			<< F(" us, p99 ") << Histogram.Percentile(99) << F(" us, max ") << Histogram.GetMax() << F(" us\n# from_us\tto_us\tcount\n");
+
+		uint8_t Used = LatencyHistogram::BucketCount;
+		while (Used && !Histogram.GetBucket(Used - 1))
+			Used--;
+		for (uint8_t Index = 0; Index < Used; Index++)
+			Stream << LatencyHistogram::BucketFrom(Index) << tab << Histogram.BucketTo(Index) << tab << Histogram.GetBucket(Index) << endl;
+		return Stream;
+	}
+
+	// * ----- LatencyTracer ------------------------------------------------------------------------------------------------------
+
+	void LatencyTracer::Trace(const StreamBase&, TraceEvent Event)
+	{
+		if (Event == TraceEvent::OperatorBegin)
+		{
+			if (Depth++ == 0)
+				Start = INO_STREAMTRACE_MICROS();
+		}
+		else if (Event == TraceEvent::OperatorEnd)
+		{
+			if (Depth && --Depth == 0)
+				Operators.Record(INO_STREAMTRACE_MICROS() - Start);
+		}
+	}
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+#ifndef INO_STREAMTRACE_INCLUDED
+#define INO_STREAMTRACE_INCLUDED
+
+#include "InoCore.h"
+#include "Clock.h"
+
+#include <Arduino.h>
+
+#ifndef INO_STREAMTRACE_MICROS
+#define INO_STREAMTRACE_MICROS() ::ino::Clock::Micros()
+#endif
+
+#ifndef INO_LATENCYHISTOGRAM_BUCKETS
+#define INO_LATENCYHISTOGRAM_BUCKETS 24
+#endif
+
+namespace ino {
+
+	class StreamBase;
+	class OutStream;
+
+	enum class TraceEvent : uint8_t {
+		OperatorBegin,	// An input or output operator was entered
+		OperatorEnd,	// The operator returns
+		Transfer,		// The operator finished the transfer (ino::OutStream::FinishTransfer / ino::InStream::FinishTransfer)
+	};
+
+	/**
+	 * @brief Receives the trace events of the streams it is attached to with ino::StreamBase::SetTracer (only called when INO_STREAMTRACE is defined).
+	 * @details Operators that call other operators of the same stream (ex. ino::Range) nest their begin and end events.
+	 */
+	class StreamTracer
+	{
+	public:
+		virtual void Trace(const StreamBase& Stream, TraceEvent Event) = 0;
+	};
+
+	/**
+	 * @brief Histogram of durations in microseconds with logarithmic buckets in fixed memory.
+	 * @details
+	 * 	Bucket 0 counts durations of 0 us, bucket `i` counts durations from `2^(i-1)` to `2^i - 1` us. The last of the `INO_LATENCYHISTOGRAM_BUCKETS` buckets counts everything above as well.
+	 * 	Printed to an ino::OutStream the histogram is a comment line with count, percentiles and maximum followed by one line `from_us	to_us	count` per bucket, which plotting tools (ex. gnuplot) read directly.
+	 */
+	class LatencyHistogram
+	{
+	private:
+		uint32_t Buckets[INO_LATENCYHISTOGRAM_BUCKETS] = {};
+		uint32_t Count = 0;
+		uint32_t Max = 0;
+
+	public:
+		constexpr static uint8_t BucketCount = INO_LATENCYHISTOGRAM_BUCKETS;
+
+		void Record(uint32_t Micros);
+		void Clear();
+
+		inline uint32_t GetCount() const { return Count; }
+		inline uint32_t GetMax() const { return Max; }
+		inline uint32_t GetBucket(uint8_t Index) const { return Buckets[Index]; }
+
+		static uint32_t BucketFrom(uint8_t Index);
+		uint32_t BucketTo(uint8_t Index) const;
+		uint32_t Percentile(uint8_t Percent) const;
+	};
+
+	OutStream& operator<<(OutStream& Stream, const LatencyHistogram& Histogram);
+
+	/**
+	 * @brief Built-in tracer that records how long every operator of a stream takes, including the time the stream waits for data, into an ino::LatencyHistogram.
+	 * @details Nested operators are measured once, as part of the outermost operator. Every stream needs its own ino::LatencyTracer.
+	 */
+	class LatencyTracer : public StreamTracer
+	{
+	private:
+		unsigned long Start = 0;
+		uint8_t Depth = 0;
+
+	public:
+		LatencyHistogram Operators;
+
+		virtual void Trace(const StreamBase& Stream, TraceEvent Event) override;
+	};
+
+}
+
+#endif
@@ -20,6 +20,7 @@ namespace ino {
 
 	protected:
 		virtual inline void Write(char Character) override { Buffer += Character; }
+		virtual inline void WriteBlock(const char* Data, unsigned int Length) override { Buffer.reserve(Buffer.length() + Length); for (unsigned int C = 0; C < Length; C++) Buffer += Data[C]; }
 
 		virtual inline char Read() override { char Char = Buffer[0]; Buffer.remove(0, 1); return Char; }
 
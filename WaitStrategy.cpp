@@ -0,0 +1,82 @@
+#include "InoCore.h"
+#include "WaitStrategy.h"
+
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#elif defined(INO_HOST)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace ino {
+
+#ifdef INO_HOST
+	namespace {
+
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+		uint32_t WakeCount = 0;
+		std::atomic<uint32_t> Sleepers(0);
+
+	}
+
+	/**
+	 * @brief Wakes all streams that sleep in ino::WaitModes::Sleep, call it after producing data from another thread (ino::RingOutStream does it).
+	 */
+	void WakeWaiting()
+	{
+		if (!Sleepers.load())
+			return;
+		{
+			std::lock_guard<std::mutex> Lock(WakeMutex);
+			WakeCount++;
+		}
+		WakeCondition.notify_all();
+	}
+#endif
+
+	/**
+	 * @brief Waits once between two checks for data.
+	 */
+	void WaitStrategy::Pause() const
+	{
+		switch (Mode)
+		{
+		case WaitModes::Spin:
+			break;
+		case WaitModes::Yield:
+			yield();
+			break;
+		case WaitModes::Sleep:
+		{
+#ifdef __AVR__
+			// Data that arrived between the check and sleep_cpu() is seen after the next interrupt (at the latest the millis() timer)
+			set_sleep_mode(SLEEP_MODE_IDLE);
+			sleep_enable();
+			sei();
+			sleep_cpu();
+			sleep_disable();
+#elif defined(INO_HOST)
+			if (Clock::IsReplaced()) // Simulated time does not pass while sleeping, polling the simulated streams advances it
+				break;
+			std::unique_lock<std::mutex> Lock(WakeMutex);
+			Sleepers++;
+			uint32_t Seen = WakeCount;
+			WakeCondition.wait_for(Lock, std::chrono::microseconds(INO_WAITSTRATEGY_HOSTSLEEP), [Seen] { return WakeCount != Seen; });
+			Sleepers--;
+#else
+			yield();
+#endif
+			break;
+		}
+		case WaitModes::Callback:
+			if (Callback)
+				Callback();
+			break;
+		}
+	}
+
+}
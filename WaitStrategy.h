@@ -0,0 +1,52 @@
+#pragma once
+#ifndef INO_WAITSTRATEGY_INCLUDED
+#define INO_WAITSTRATEGY_INCLUDED
+
+#include "InoCore.h"
+#include "Clock.h"
+
+#include <Arduino.h>
+
+#ifdef INO_HOST
+#ifndef INO_WAITSTRATEGY_HOSTSLEEP
+#define INO_WAITSTRATEGY_HOSTSLEEP 1000
+#endif
+#endif
+
+namespace ino {
+
+	enum class WaitModes : uint8_t {
+		Spin,		// Checks again right away
+		Yield,		// Calls `yield()` between the checks, so cooperative tasks keep running
+		Sleep,		// Sleeps until the next interrupt between the checks (AVR idle sleep), on host until ino::WakeWaiting() is called or `INO_WAITSTRATEGY_HOSTSLEEP` microseconds passed (not at all when ino::Clock is replaced by a simulation)
+		Callback,	// Calls the callback between the checks, ex. to do other work
+	};
+
+	/**
+	 * @brief How an input stream waits in ino::InStream::NoDataAvailable, see ino::InStream::SetWait.
+	 * @details
+	 * 	`Deadline` is the longest wait in milliseconds of ino::Clock, afterwards the fail flag ino::InStream::Fails::NoData is set. `0` waits until data arrives.
+	 * 	Ex. `ino::in.SetWait(ino::WaitStrategy(ino::WaitModes::Sleep, 500));`
+	 */
+	struct WaitStrategy
+	{
+		WaitModes Mode = WaitModes::Spin;
+		void (*Callback)() = nullptr;
+		unsigned long Deadline = 0;
+
+		WaitStrategy() {}
+		WaitStrategy(WaitModes Mode, unsigned long Deadline = 0) : Mode(Mode), Deadline(Deadline) {}
+		WaitStrategy(void (*Callback)(), unsigned long Deadline = 0) : Mode(WaitModes::Callback), Callback(Callback), Deadline(Deadline) {}
+
+		void Pause() const;
+	};
+
+#ifdef INO_HOST
+	void WakeWaiting();
+#else
+	inline void WakeWaiting() {} // Interrupts wake the controller
+#endif
+
+}
+
+#endif
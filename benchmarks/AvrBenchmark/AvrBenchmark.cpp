@@ -0,0 +1,223 @@
+/**
+ * AVR benchmark of the output and input operators, counts CPU cycles per operation with Timer1.
+ *
+ * Build and run under simavr (no board needed, from the repository root):
+ * 	pio run -d benchmarks/AvrBenchmark
+ * 	~/.platformio/packages/tool-simavr/bin/simavr -m atmega328p -f 16000000 benchmarks/AvrBenchmark/.pio/build/uno/firmware.elf
+ * The report is printed to UART0, which simavr writes to the console. The simulation ends when the benchmark is done.
+ *
+ * Flash and RAM use of every operator instantiation:
+ * 	benchmarks/AvrBenchmark/sizes.sh benchmarks/AvrBenchmark/.pio/build/uno/firmware.elf
+ *
+ * The target is the ATmega328P (Arduino Uno, 32 KB flash, 2 KB RAM), the same sketch runs on a real Uno with identical cycle counts.
+ * The library itself is built with its library.json, whose source filter keeps benchmarks/ and examples/ out of it.
+ */
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include <IOStream.h>
+#include <SpanInStream.h>
+
+namespace {
+
+	volatile uint16_t Overflows = 0;
+
+	/**
+	 * @brief Counts every CPU cycle: Timer1 runs without prescaler, its overflows extend it to 32 bit.
+	 */
+	inline uint32_t Cycles()
+	{
+		uint8_t Sreg = SREG;
+		cli();
+		uint16_t Low = TCNT1;
+		uint16_t High = Overflows;
+		if ((TIFR1 & _BV(TOV1)) && Low < 0x8000)
+			High++;
+		SREG = Sreg;
+		return static_cast<uint32_t>(High) << 16 | Low;
+	}
+
+	void StartCycleCounter()
+	{
+		TCCR1A = 0;
+		TCCR1B = _BV(CS10);
+		TCNT1 = 0;
+		TIFR1 = _BV(TOV1);
+		TIMSK1 = _BV(TOIE1);
+	}
+
+	class NullOutStream : public ino::OutStream
+	{
+	public:
+		uint16_t Length = 0;
+
+	protected:
+		virtual void Write(char) override { Length++; }
+		virtual void WriteBlock(const char*, unsigned int BlockLength) override { Length += BlockLength; }
+	};
+
+	NullOutStream Null;
+	constexpr uint8_t Runs = 8;
+	uint32_t Overhead = 0;
+
+	/**
+	 * @brief Runs `Body(Index)` for every value and prints the average cycles per operation.
+	 */
+	template <typename BodyT>
+	void Measure(const __FlashStringHelper* Name, BodyT Body)
+	{
+		uint32_t Start = Cycles();
+		for (uint8_t Index = 0; Index < Runs; Index++)
+			Body(Index);
+		uint32_t Total = Cycles() - Start;
+		Total = Total > Overhead ? Total - Overhead : 0;
+
+		ino::out << Name << '\t' << Total / Runs << F(" cycles/op") << ino::endl;
+	}
+
+	// Values are volatile, so the compiler cannot fold the conversions
+	volatile int8_t Int8s[Runs] = { 0, 7, -13, 42, -99, 100, 127, -127 };
+	volatile uint8_t Uint8s[Runs] = { 0, 7, 13, 42, 99, 100, 200, 255 };
+	volatile int16_t Int16s[Runs] = { 0, 9, -321, 4242, -9999, 12345, 32767, -32767 };
+	volatile uint16_t Uint16s[Runs] = { 0, 9, 321, 4242, 9999, 12345, 50000, 65535 };
+	volatile int32_t Int32s[Runs] = { 0, 99, -4321, 424242, -9999999, 123456789, 2147483647L, -2147483647L };
+	volatile uint32_t Uint32s[Runs] = { 0, 99, 4321, 424242, 9999999, 123456789, 3000000000UL, 4294967295UL };
+	volatile int64_t Int64s[Runs] = { 0, 99, -4321, 42424242, -99999999999LL, 123456789012345LL, 9223372036854775807LL, -9223372036854775807LL };
+	volatile uint64_t Uint64s[Runs] = { 0, 99, 4321, 42424242, 99999999999ULL, 123456789012345ULL, 9223372036854775807ULL, 18446744073709551615ULL };
+	volatile float Floats[Runs] = { 0.0f, 1.5f, -3.25f, 42.42f, -999.999f, 12345.678f, 0.001f, -0.5f };
+	volatile bool Bools[Runs] = { true, false, true, true, false, false, true, false };
+
+	constexpr uint8_t RangeSize = 16;
+	int16_t RangeInt16s[RangeSize]; // Filled from the volatile values before the range cases
+	float RangeFloats[RangeSize];
+
+	template <typename T>
+	void MeasureIntegerOut(const __FlashStringHelper* Dec, const __FlashStringHelper* Bin, const __FlashStringHelper* Hex, volatile T* Values)
+	{
+		Measure(Dec, [&](uint8_t Index) { Null << static_cast<T>(Values[Index]); });
+		Measure(Bin, [&](uint8_t Index) { Null << ino::Bin(static_cast<T>(Values[Index])); });
+		Measure(Hex, [&](uint8_t Index) { Null << ino::Hex(static_cast<T>(Values[Index])); });
+	}
+
+	void MeasureOut()
+	{
+		ino::out << ino::endl << F("--- output (null sink)") << ino::endl;
+		MeasureIntegerOut(F("<< int8_t"), F("<< int8_t Bin"), F("<< int8_t Hex"), Int8s);
+		MeasureIntegerOut(F("<< uint8_t"), F("<< uint8_t Bin"), F("<< uint8_t Hex"), Uint8s);
+		MeasureIntegerOut(F("<< int16_t"), F("<< int16_t Bin"), F("<< int16_t Hex"), Int16s);
+		MeasureIntegerOut(F("<< uint16_t"), F("<< uint16_t Bin"), F("<< uint16_t Hex"), Uint16s);
+		MeasureIntegerOut(F("<< int32_t"), F("<< int32_t Bin"), F("<< int32_t Hex"), Int32s);
+		MeasureIntegerOut(F("<< uint32_t"), F("<< uint32_t Bin"), F("<< uint32_t Hex"), Uint32s);
+		MeasureIntegerOut(F("<< int64_t"), F("<< int64_t Bin"), F("<< int64_t Hex"), Int64s);
+		MeasureIntegerOut(F("<< uint64_t"), F("<< uint64_t Bin"), F("<< uint64_t Hex"), Uint64s);
+
+		Measure(F("<< float"), [](uint8_t Index) { Null << static_cast<float>(Floats[Index]); });
+		Measure(F("<< float Precision 0"), [](uint8_t Index) { Null << ino::Precision(static_cast<float>(Floats[Index]), 0); });
+		Measure(F("<< float Precision 2"), [](uint8_t Index) { Null << ino::Precision(static_cast<float>(Floats[Index]), 2); });
+		Measure(F("<< float Precision 6"), [](uint8_t Index) { Null << ino::Precision(static_cast<float>(Floats[Index]), 6); });
+		Measure(F("<< float Precision 2 DecimalComma"), [](uint8_t Index) { Null << ino::Format(static_cast<float>(Floats[Index]), ino::PrecisionFormats(2), ino::Fmt::DecimalComma); });
+
+		Measure(F("<< bool"), [](uint8_t Index) { Null << static_cast<bool>(Bools[Index]); });
+		Measure(F("<< bool BoolNum"), [](uint8_t Index) { Null << ino::BoolNum(static_cast<bool>(Bools[Index])); });
+		Measure(F("<< const char*"), [](uint8_t Index) { Null << (Index & 1 ? "temperature" : "ok"); });
+		Measure(F("<< uint32_t Hex Uppercase"), [](uint8_t Index) { Null << ino::Format(static_cast<uint32_t>(Uint32s[Index]), ino::Fmt::Hex, ino::Fmt::Uppercase); });
+
+		// The range operator next to the hand-written loop it replaces
+		for (uint8_t C = 0; C < RangeSize; C++)
+		{
+			RangeInt16s[C] = Int16s[C % Runs];
+			RangeFloats[C] = Floats[C % Runs];
+		}
+		Measure(F("<< int16_t[16] Range"), [](uint8_t) { Null << ino::Range(RangeInt16s, ino::Sep(", ")); });
+		Measure(F("<< int16_t[16] loop"), [](uint8_t) {
+			for (uint8_t C = 0; C < RangeSize; C++)
+			{
+				if (C)
+					Null << ", ";
+				Null << RangeInt16s[C];
+			}
+		});
+		Measure(F("<< float[16] Range"), [](uint8_t) { Null << ino::Range(RangeFloats, ino::Sep(", ")); });
+		Measure(F("<< float[16] loop"), [](uint8_t) {
+			for (uint8_t C = 0; C < RangeSize; C++)
+			{
+				if (C)
+					Null << ", ";
+				Null << RangeFloats[C];
+			}
+		});
+	}
+
+	/**
+	 * @brief Parses one transfer from `Text` per operation.
+	 */
+	template <typename ParseT>
+	void MeasureIn(const __FlashStringHelper* Name, const char* Text, ParseT Parse)
+	{
+		size_t Length = strlen(Text);
+		Measure(Name, [&](uint8_t) {
+			ino::SpanInStream Stream(Text, Length);
+			Stream.SetEnd('\n');
+			Parse(Stream);
+		});
+	}
+
+	void MeasureInput()
+	{
+		ino::out << ino::endl << F("--- input (ino::SpanInStream)") << ino::endl;
+		static int16_t Int16;
+		static uint16_t Uint16;
+		static int32_t Int32;
+		static uint32_t Uint32;
+		static int64_t Int64;
+		static uint64_t Uint64;
+		static float Float;
+		static bool Bool;
+		static char Text[16];
+
+		MeasureIn(F(">> int16_t"), "-12345\n", [](ino::InStream& Stream) { Stream >> Int16; });
+		MeasureIn(F(">> uint16_t Hex"), "beef\n", [](ino::InStream& Stream) { Stream >> ino::Hex(Uint16); });
+		MeasureIn(F(">> int32_t"), "-123456789\n", [](ino::InStream& Stream) { Stream >> Int32; });
+		MeasureIn(F(">> uint32_t"), "4000000000\n", [](ino::InStream& Stream) { Stream >> Uint32; });
+		MeasureIn(F(">> int64_t"), "-1234567890123456\n", [](ino::InStream& Stream) { Stream >> Int64; });
+		MeasureIn(F(">> uint64_t"), "18446744073709551615\n", [](ino::InStream& Stream) { Stream >> Uint64; });
+		MeasureIn(F(">> float"), "-12345.678\n", [](ino::InStream& Stream) { Stream >> Float; });
+		MeasureIn(F(">> float Precision 2"), "42.42\n", [](ino::InStream& Stream) { Stream >> ino::Precision(Float, 2); });
+		MeasureIn(F(">> bool"), "true\n", [](ino::InStream& Stream) { Stream >> Bool; });
+		MeasureIn(F(">> CString Max 16"), "temperature\n", [](ino::InStream& Stream) { Stream >> ino::CString(Text, ino::CStringFormats(sizeof(Text))); });
+	}
+
+}
+
+ISR(TIMER1_OVF_vect)
+{
+	Overflows++;
+}
+
+void setup()
+{
+	ino::out.begin(115200);
+	StartCycleCounter();
+
+	uint32_t Start = Cycles();
+	for (uint8_t Index = 0; Index < Runs; Index++)
+		asm volatile("");
+	Overhead = Cycles() - Start;
+
+	ino::out << F("InoStreams AVR benchmark, ") << static_cast<uint32_t>(F_CPU) << F(" Hz, ") << Runs << F(" runs per case") << ino::endl;
+	MeasureOut();
+	MeasureInput();
+
+	// Sleeping with interrupts disabled ends the simulation
+	Serial.flush();
+	cli();
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Lists the flash and RAM use of every function and object of the library in an AVR build, largest first.
+# Every template instantiation is a separate symbol, so the list shows the cost of each instantiated operator.
+# Usage: sizes.sh [firmware.elf] [filter]
+
+Elf=${1:-.pio/build/uno/firmware.elf}
+Filter=${2:-ino::}
+Nm=${AVR_NM:-avr-nm}
+
+"$Nm" --demangle --print-size --size-sort --radix=d "$Elf" | grep -F -- "$Filter" | awk '
+{
+	Size = $2 + 0
+	Type = $3
+	Name = $4
+	for (I = 5; I <= NF; I++)
+		Name = Name " " $I
+	if (Type ~ /^[TtWw]$/) { Kind = "flash"; Flash += Size }
+	else if (Type ~ /^[DdBbVv]$/) { Kind = "ram"; Ram += Size }
+	else if (Type ~ /^[Rr]$/) { Kind = "flash"; Flash += Size }
+	else next
+	printf "%6d  %-5s  %s\n", Size, Kind, Name | "sort -rn -k1,1"
+}
+END {
+	close("sort -rn -k1,1")
+	printf "\n%6d  flash total\n%6d  ram total\n", Flash, Ram
+}'
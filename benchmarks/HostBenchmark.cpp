@@ -0,0 +1,512 @@
+/**
+ * Host benchmark of the output and input operators, compared to snprintf / strtol, std::to_chars / std::from_chars and std::ostringstream / std::istringstream.
+ *
+ * Build (from the repository root, with the Ino library and an Arduino shim providing `String` in the include path):
+ * 	g++ -O2 -std=c++17 -DINO_HOST -pthread -I. -I<Ino> -I<ArduinoShim> benchmarks/HostBenchmark.cpp *.cpp -o HostBenchmark
+ * Run:
+ * 	./HostBenchmark [milliseconds per case] [filter]
+ *
+ * Ranges are measured with ino::Range and with the hand-written per-element loop it replaces.
+ * Every case reports the time per operation and the throughput in formatted (or parsed) bytes per second.
+ * Output operators run through a null sink, which only counts the characters, and through a memory sink (ino::SpanOutStream).
+ */
+
+#include <Arduino.h>
+
+#include <IOStream.h>
+#include <SpanOutStream.h>
+#include <SpanInStream.h>
+
+#include <charconv>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+	constexpr size_t ValueCount = 1024; // Power of two, values are cycled with a mask
+	double CaseMillis = 50;
+	const char* Filter = nullptr;
+
+	class NullOutStream : public ino::OutStream
+	{
+	public:
+		size_t Length = 0;
+
+	protected:
+		virtual void Write(char) override { Length++; }
+		virtual void WriteBlock(const char*, unsigned int BlockLength) override { Length += BlockLength; }
+	};
+
+	char MemoryBuffer[1 << 16];
+
+	/**
+	 * @brief Memory sink, rewinds before it could overflow, so every operation formats into memory.
+	 */
+	class MemorySink : public ino::SpanOutStream
+	{
+	public:
+		size_t Length = 0;
+
+		MemorySink() : SpanOutStream(MemoryBuffer, sizeof(MemoryBuffer)) {}
+
+		inline void Prepare()
+		{
+			if (GetLength() > sizeof(MemoryBuffer) - 1024)
+			{
+				Length += GetLength();
+				Clear();
+			}
+		}
+
+		inline size_t Total() const { return Length + GetLength(); }
+	};
+
+	volatile size_t Sink; // Keeps results of the reference functions alive
+
+	void PrintPadded(const char* Text, size_t Width)
+	{
+		size_t Length = strlen(Text);
+		ino::out << Text;
+		while (Length++ < Width)
+			ino::out << ' ';
+	}
+
+	/**
+	 * @brief Runs `Body(Index)` until `CaseMillis` have passed. `Body` returns the number of bytes it formatted or parsed.
+	 */
+	template <typename BodyT>
+	void Measure(const std::string& Name, BodyT Body)
+	{
+		if (Filter && Name.find(Filter) == std::string::npos)
+			return;
+
+		using Clock = std::chrono::steady_clock;
+		size_t Iterations = 1024;
+		size_t Total = 0;
+		size_t Bytes = 0;
+		double Nanos = 0;
+		for (size_t Index = 0; Index < 4 * ValueCount; Index++) // Warm up
+			Body(Index);
+		while (Nanos < CaseMillis * 1e6)
+		{
+			Clock::time_point Start = Clock::now();
+			for (size_t Index = 0; Index < Iterations; Index++)
+				Bytes += Body(Index);
+			Nanos += std::chrono::duration<double, std::nano>(Clock::now() - Start).count();
+			Total += Iterations;
+			Iterations *= 2;
+		}
+
+		double NanosPerOp = Nanos / Total;
+		double BytesPerSecond = Bytes / (Nanos * 1e-9);
+		PrintPadded(Name.c_str(), 44);
+		ino::out << ino::Precision(NanosPerOp, 2) << " ns/op  " << ino::Precision(BytesPerSecond / 1e6, 1) << " MB/s" << ino::endl;
+	}
+
+	void Section(const char* Name)
+	{
+		ino::out << ino::endl << "--- " << Name << ino::endl;
+	}
+
+	/**
+	 * @brief Random values of all magnitudes, so the formatted lengths vary like in real data.
+	 */
+	template <typename T>
+	std::vector<T> MakeIntegers()
+	{
+		std::mt19937_64 Random(42);
+		std::vector<T> Values(ValueCount);
+		for (T& Value : Values)
+			Value = static_cast<T>(Random() >> (Random() % 64));
+		return Values;
+	}
+
+	template <typename T>
+	std::vector<T> MakeFloats()
+	{
+		std::mt19937_64 Random(42);
+		std::uniform_real_distribution<double> Mantissa(-1.0, 1.0);
+		std::vector<T> Values(ValueCount);
+		for (T& Value : Values)
+			Value = static_cast<T>(Mantissa(Random) * pow(10.0, static_cast<int>(Random() % 9)));
+		return Values;
+	}
+
+	// * ----- Output ------------------------------------------------------------------------------------------------------------
+
+	template <typename SinkT, typename T, typename... FmtTs>
+	void MeasureOut(const std::string& Name, const std::vector<T>& Values, const FmtTs&... Formats)
+	{
+		SinkT Stream;
+		Measure(Name, [&](size_t Index) -> size_t {
+			Prepare(Stream);
+			size_t Before = Written(Stream);
+			Stream << ino::Format(Values[Index & (ValueCount - 1)], Formats...);
+			return Written(Stream) - Before;
+		});
+	}
+
+	template <typename SinkT, typename T>
+	void MeasureOutDefault(const std::string& Name, const std::vector<T>& Values)
+	{
+		SinkT Stream;
+		Measure(Name, [&](size_t Index) -> size_t {
+			Prepare(Stream);
+			size_t Before = Written(Stream);
+			Stream << Values[Index & (ValueCount - 1)];
+			return Written(Stream) - Before;
+		});
+	}
+
+	inline void Prepare(NullOutStream&) {}
+	inline void Prepare(MemorySink& Stream) { Stream.Prepare(); }
+	inline size_t Written(const NullOutStream& Stream) { return Stream.Length; }
+	inline size_t Written(const MemorySink& Stream) { return Stream.Total(); }
+
+	template <typename SinkT, typename T>
+	void IntegerOut(const char* Sink, const char* Type)
+	{
+		std::vector<T> Values = MakeIntegers<T>();
+		std::string Prefix = std::string(Sink) + " << " + Type;
+		MeasureOutDefault<SinkT>(Prefix, Values);
+		MeasureOut<SinkT>(Prefix + " Bin", Values, ino::Fmt::Bin);
+		MeasureOut<SinkT>(Prefix + " Oct", Values, ino::Fmt::Oct);
+		MeasureOut<SinkT>(Prefix + " Hex", Values, ino::Fmt::Hex);
+	}
+
+	template <typename SinkT, typename T>
+	void FloatOut(const char* Sink, const char* Type)
+	{
+		std::vector<T> Values = MakeFloats<T>();
+		std::string Prefix = std::string(Sink) + " << " + Type;
+		MeasureOutDefault<SinkT>(Prefix, Values);
+		for (uint8_t Precision : { 0, 1, 2, 4, 6, 8 })
+			MeasureOut<SinkT>(Prefix + " Precision " + std::to_string(Precision), Values, ino::PrecisionFormats(Precision));
+	}
+
+	template <typename SinkT>
+	void OtherOut(const char* Sink)
+	{
+		std::string Prefix = std::string(Sink) + " << ";
+		std::vector<uint8_t> BoolValues = MakeIntegers<uint8_t>();
+		std::vector<char> BoolsAsChar(BoolValues.begin(), BoolValues.end());
+		{
+			SinkT Stream;
+			Measure(Prefix + "bool", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << static_cast<bool>(BoolsAsChar[Index & (ValueCount - 1)] & 1); return Written(Stream) - Before; });
+			Measure(Prefix + "bool BoolCaps", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << ino::BoolCaps(static_cast<bool>(BoolsAsChar[Index & (ValueCount - 1)] & 1)); return Written(Stream) - Before; });
+			Measure(Prefix + "bool BoolNum", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << ino::BoolNum(static_cast<bool>(BoolsAsChar[Index & (ValueCount - 1)] & 1)); return Written(Stream) - Before; });
+		}
+
+		const char* Texts[] = { "ok", "temperature", "a somewhat longer status message", "" };
+		String Strings[] = { "ok", "temperature", "a somewhat longer status message", "" };
+		char Arrays[4][40];
+		for (size_t C = 0; C < 4; C++)
+			strcpy(Arrays[C], Texts[C]);
+		{
+			SinkT Stream;
+			Measure(Prefix + "const char*", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << Texts[Index & 3]; return Written(Stream) - Before; });
+			Measure(Prefix + "String", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << Strings[Index & 3]; return Written(Stream) - Before; });
+			Measure(Prefix + "CString Max 8", [&](size_t Index) -> size_t { Prepare(Stream); size_t Before = Written(Stream); Stream << ino::CString(Arrays[Index & 3], ino::CStringFormats(8)); return Written(Stream) - Before; });
+		}
+
+		std::vector<uint32_t> Words = MakeIntegers<uint32_t>();
+		std::vector<double> Doubles = MakeFloats<double>();
+		MeasureOut<SinkT>(Prefix + "uint32_t Hex Uppercase", Words, ino::Fmt::Hex, ino::Fmt::Uppercase);
+		MeasureOut<SinkT>(Prefix + "uint32_t Hex FullFormat", Words, ino::BaseFormats(16, ino::BaseFormats::Mode::FullFormat));
+		MeasureOut<SinkT>(Prefix + "double Precision 3 DecimalComma", Doubles, ino::PrecisionFormats(3), ino::Fmt::DecimalComma);
+		MeasureOut<SinkT>(Prefix + "double Precision 3 SpecialnumLong", Doubles, ino::PrecisionFormats(3), ino::Fmt::SpecialnumberLong);
+	}
+
+	constexpr size_t RangeSize = 32; // Elements per range, a divisor of ValueCount
+
+	/**
+	 * @brief The range operator next to the hand-written loop it replaces, both print `RangeSize` elements separated by `, `.
+	 */
+	template <typename SinkT, typename T>
+	void RangeOut(const char* Sink, const char* Type, const std::vector<T>& Values)
+	{
+		std::string Prefix = std::string(Sink) + " << " + Type + "[" + std::to_string(RangeSize) + "]";
+		SinkT Stream;
+		Measure(Prefix + " Range", [&](size_t Index) -> size_t {
+			Prepare(Stream);
+			size_t Before = Written(Stream);
+			Stream << ino::Range(&Values[(Index * RangeSize) & (ValueCount - 1)], RangeSize, ino::Sep(", "));
+			return Written(Stream) - Before;
+		});
+		Measure(Prefix + " loop", [&](size_t Index) -> size_t {
+			Prepare(Stream);
+			size_t Before = Written(Stream);
+			const T* Elements = &Values[(Index * RangeSize) & (ValueCount - 1)];
+			for (size_t C = 0; C < RangeSize; C++)
+			{
+				if (C)
+					Stream << ", ";
+				Stream << Elements[C];
+			}
+			return Written(Stream) - Before;
+		});
+	}
+
+	template <typename SinkT>
+	void AllOut(const char* Sink)
+	{
+		Section(Sink);
+		IntegerOut<SinkT, int8_t>(Sink, "int8_t");
+		IntegerOut<SinkT, uint8_t>(Sink, "uint8_t");
+		IntegerOut<SinkT, int16_t>(Sink, "int16_t");
+		IntegerOut<SinkT, uint16_t>(Sink, "uint16_t");
+		IntegerOut<SinkT, int32_t>(Sink, "int32_t");
+		IntegerOut<SinkT, uint32_t>(Sink, "uint32_t");
+		IntegerOut<SinkT, int64_t>(Sink, "int64_t");
+		IntegerOut<SinkT, uint64_t>(Sink, "uint64_t");
+		FloatOut<SinkT, float>(Sink, "float");
+		FloatOut<SinkT, double>(Sink, "double");
+		OtherOut<SinkT>(Sink);
+		RangeOut<SinkT>(Sink, "int32_t", MakeIntegers<int32_t>());
+		RangeOut<SinkT>(Sink, "float", MakeFloats<float>());
+	}
+
+	void ReferenceOut()
+	{
+		Section("reference formatting");
+		char Buffer[64];
+		std::vector<int32_t> Ints = MakeIntegers<int32_t>();
+		std::vector<uint64_t> Longs = MakeIntegers<uint64_t>();
+		std::vector<double> Doubles = MakeFloats<double>();
+
+		Measure("snprintf int32_t", [&](size_t Index) -> size_t { return snprintf(Buffer, sizeof(Buffer), "%" PRId32, Ints[Index & (ValueCount - 1)]); });
+		Measure("snprintf int32_t Hex", [&](size_t Index) -> size_t { return snprintf(Buffer, sizeof(Buffer), "%" PRIx32, Ints[Index & (ValueCount - 1)]); });
+		Measure("snprintf uint64_t", [&](size_t Index) -> size_t { return snprintf(Buffer, sizeof(Buffer), "%" PRIu64, Longs[Index & (ValueCount - 1)]); });
+		for (int Precision : { 0, 2, 6 })
+			Measure("snprintf double Precision " + std::to_string(Precision), [&](size_t Index) -> size_t { return snprintf(Buffer, sizeof(Buffer), "%.*f", Precision, Doubles[Index & (ValueCount - 1)]); });
+
+		Measure("to_chars int32_t", [&](size_t Index) -> size_t { return std::to_chars(Buffer, Buffer + sizeof(Buffer), Ints[Index & (ValueCount - 1)]).ptr - Buffer; });
+		Measure("to_chars int32_t Hex", [&](size_t Index) -> size_t { return std::to_chars(Buffer, Buffer + sizeof(Buffer), Ints[Index & (ValueCount - 1)], 16).ptr - Buffer; });
+		Measure("to_chars int32_t Bin", [&](size_t Index) -> size_t { return std::to_chars(Buffer, Buffer + sizeof(Buffer), Ints[Index & (ValueCount - 1)], 2).ptr - Buffer; });
+		Measure("to_chars uint64_t", [&](size_t Index) -> size_t { return std::to_chars(Buffer, Buffer + sizeof(Buffer), Longs[Index & (ValueCount - 1)]).ptr - Buffer; });
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+		for (int Precision : { 0, 2, 6 })
+			Measure("to_chars double Precision " + std::to_string(Precision), [&](size_t Index) -> size_t { return std::to_chars(Buffer, Buffer + sizeof(Buffer), Doubles[Index & (ValueCount - 1)], std::chars_format::fixed, Precision).ptr - Buffer; });
+#endif
+
+		std::ostringstream Stream;
+		auto Reset = [&Stream](size_t Index) { if ((Index & 4095) == 0) Stream.seekp(0); };
+		auto Position = [&Stream]() { return static_cast<size_t>(Stream.tellp()); };
+		Measure("ostringstream int32_t", [&](size_t Index) -> size_t { Reset(Index); size_t Before = Position(); Stream << Ints[Index & (ValueCount - 1)]; return Position() - Before; });
+		Measure("ostringstream int32_t Hex", [&](size_t Index) -> size_t { Reset(Index); size_t Before = Position(); Stream << std::hex << Ints[Index & (ValueCount - 1)] << std::dec; return Position() - Before; });
+		Measure("ostringstream uint64_t", [&](size_t Index) -> size_t { Reset(Index); size_t Before = Position(); Stream << Longs[Index & (ValueCount - 1)]; return Position() - Before; });
+		Stream << std::fixed;
+		for (int Precision : { 0, 2, 6 })
+			Measure("ostringstream double Precision " + std::to_string(Precision), [&](size_t Index) -> size_t { Reset(Index); size_t Before = Position(); Stream.precision(Precision); Stream << Doubles[Index & (ValueCount - 1)]; return Position() - Before; });
+	}
+
+	// * ----- Input -------------------------------------------------------------------------------------------------------------
+
+	/**
+	 * @brief Formats the values one per line, so they can be parsed again as separate transfers.
+	 */
+	template <typename T, typename... FmtTs>
+	std::string MakeText(const std::vector<T>& Values, const FmtTs&... Formats)
+	{
+		std::vector<char> Buffer(ValueCount * 80);
+		ino::SpanOutStream Stream(Buffer.data(), Buffer.size());
+		Stream.SetEnd('\n');
+		for (const T& Value : Values)
+			Stream << ino::Format(Value, Formats...);
+		return std::string(Buffer.data(), Stream.GetLength());
+	}
+
+	template <typename T>
+	std::string MakeTextDefault(const std::vector<T>& Values)
+	{
+		std::vector<char> Buffer(ValueCount * 80);
+		ino::SpanOutStream Stream(Buffer.data(), Buffer.size());
+		Stream.SetEnd('\n');
+		for (const T& Value : Values)
+			Stream << Value;
+		return std::string(Buffer.data(), Stream.GetLength());
+	}
+
+	/**
+	 * @brief Parses the text transfer by transfer with `Parse(Stream)`, starting over at the end of the text. Reports fails once.
+	 */
+	template <typename ParseT>
+	void MeasureIn(const std::string& Name, const std::string& Text, ParseT Parse)
+	{
+		ino::SpanInStream Stream(Text.data(), Text.size());
+		Stream.SetEnd('\n');
+		bool Reported = false;
+		Measure(Name, [&](size_t) -> size_t {
+			if (!Stream.SpanSize())
+			{
+				Stream = ino::SpanInStream(Text.data(), Text.size());
+				Stream.SetEnd('\n');
+			}
+			size_t Before = Stream.SpanSize();
+			Parse(Stream);
+			if (Stream.Failed())
+			{
+				if (!Reported)
+					ino::out << "(" << Name.c_str() << " failed) ";
+				Reported = true;
+				Stream.ClearFails();
+			}
+			return Before - Stream.SpanSize();
+		});
+	}
+
+	template <typename T>
+	void IntegerIn(const char* Type)
+	{
+		std::vector<T> Values = MakeIntegers<T>();
+		std::string Prefix = std::string("in >> ") + Type;
+		T Value;
+		MeasureIn(Prefix, MakeTextDefault(Values), [&](ino::InStream& Stream) { Stream >> Value; Sink = Value; });
+		MeasureIn(Prefix + " Hex", MakeText(Values, ino::Fmt::Hex), [&](ino::InStream& Stream) { Stream >> ino::Hex(Value); Sink = Value; });
+		MeasureIn(Prefix + " Bin", MakeText(Values, ino::Fmt::Bin), [&](ino::InStream& Stream) { Stream >> ino::Bin(Value); Sink = Value; });
+	}
+
+	template <typename T>
+	void FloatIn(const char* Type)
+	{
+		std::vector<T> Values = MakeFloats<T>();
+		std::string Prefix = std::string("in >> ") + Type;
+		T Value;
+		MeasureIn(Prefix, MakeTextDefault(Values), [&](ino::InStream& Stream) { Stream >> Value; Sink = static_cast<size_t>(Value); });
+		for (uint8_t Precision : { 2, 6 })
+			MeasureIn(Prefix + " Precision " + std::to_string(Precision), MakeText(Values, ino::PrecisionFormats(Precision)), [&](ino::InStream& Stream) { Stream >> ino::Precision(Value, Precision); Sink = static_cast<size_t>(Value); });
+	}
+
+	/**
+	 * @brief The range operator reading one line of `RangeSize` elements next to a hand-written loop reading them one per line.
+	 */
+	template <typename T>
+	void RangeIn(const char* Type, const std::vector<T>& Values)
+	{
+		std::string Prefix = std::string("in >> ") + Type + "[" + std::to_string(RangeSize) + "]";
+		std::vector<char> Buffer(ValueCount * 80);
+		ino::SpanOutStream Lines(Buffer.data(), Buffer.size());
+		Lines.SetEnd('\n');
+		for (size_t C = 0; C < ValueCount; C += RangeSize)
+			Lines << ino::Range(&Values[C], RangeSize, ino::Sep(','));
+
+		T Elements[RangeSize];
+		MeasureIn(Prefix + " Range", std::string(Buffer.data(), Lines.GetLength()), [&](ino::InStream& Stream) { Stream >> ino::Range(Elements, ino::Sep(',')); Sink = static_cast<size_t>(Elements[0]); });
+		MeasureIn(Prefix + " loop", MakeTextDefault(Values), [&](ino::InStream& Stream) {
+			for (size_t C = 0; C < RangeSize; C++)
+				Stream >> Elements[C];
+			Sink = static_cast<size_t>(Elements[0]);
+		});
+	}
+
+	void AllIn()
+	{
+		Section("ino::SpanInStream");
+		IntegerIn<int8_t>("int8_t");
+		IntegerIn<uint8_t>("uint8_t");
+		IntegerIn<int16_t>("int16_t");
+		IntegerIn<uint16_t>("uint16_t");
+		IntegerIn<int32_t>("int32_t");
+		IntegerIn<uint32_t>("uint32_t");
+		IntegerIn<int64_t>("int64_t");
+		IntegerIn<uint64_t>("uint64_t");
+		FloatIn<float>("float");
+		FloatIn<double>("double");
+
+		std::vector<uint8_t> BoolValues = MakeIntegers<uint8_t>();
+		std::vector<bool> Bools;
+		for (uint8_t Value : BoolValues)
+			Bools.push_back(Value & 1);
+		bool Flag;
+		MeasureIn("in >> bool", MakeTextDefault(Bools), [&](ino::InStream& Stream) { Stream >> Flag; Sink = Flag; });
+		MeasureIn("in >> bool BoolNum", MakeText(Bools, ino::Fmt::BoolNum), [&](ino::InStream& Stream) { Stream >> ino::BoolNum(Flag); Sink = Flag; });
+
+		std::string Words;
+		for (size_t C = 0; C < ValueCount; C++)
+			Words += C % 3 ? "temperature\n" : "ok\n";
+		String Text;
+		char CText[16];
+		MeasureIn("in >> String", Words, [&](ino::InStream& Stream) { Text = ""; Stream >> Text; Sink = Text.length(); });
+		MeasureIn("in >> CString Max 16", Words, [&](ino::InStream& Stream) { Stream >> ino::CString(CText, ino::CStringFormats(sizeof(CText))); Sink = CText[0]; });
+
+		std::vector<uint32_t> Words32 = MakeIntegers<uint32_t>();
+		uint32_t Word;
+		MeasureIn("in >> uint32_t Hex Uppercase", MakeText(Words32, ino::Fmt::Hex, ino::Fmt::Uppercase), [&](ino::InStream& Stream) { Stream >> ino::Format(Word, ino::Fmt::Hex, ino::Fmt::Uppercase); Sink = Word; });
+		std::vector<double> Doubles = MakeFloats<double>();
+		double Real;
+		MeasureIn("in >> double Precision 3 DecimalComma", MakeText(Doubles, ino::PrecisionFormats(3), ino::Fmt::DecimalComma), [&](ino::InStream& Stream) { Stream >> ino::Format(Real, ino::PrecisionFormats(3), ino::Fmt::DecimalComma); Sink = static_cast<size_t>(Real); });
+
+		RangeIn("int32_t", MakeIntegers<int32_t>());
+		RangeIn("float", MakeFloats<float>());
+	}
+
+	/**
+	 * @brief Parses the lines of the text with `Parse(Begin, End)`, starting over at the end of the text.
+	 */
+	template <typename ParseT>
+	void MeasureReferenceIn(const std::string& Name, const std::string& Text, ParseT Parse)
+	{
+		const char* Position = Text.data();
+		const char* End = Text.data() + Text.size();
+		Measure(Name, [&](size_t) -> size_t {
+			if (Position == End)
+				Position = Text.data();
+			const char* LineEnd = static_cast<const char*>(memchr(Position, '\n', End - Position));
+			Parse(Position, LineEnd);
+			size_t Length = LineEnd + 1 - Position;
+			Position = LineEnd + 1;
+			return Length;
+		});
+	}
+
+	void ReferenceIn()
+	{
+		Section("reference parsing");
+		std::string Ints = MakeTextDefault(MakeIntegers<int32_t>());
+		std::string Longs = MakeTextDefault(MakeIntegers<uint64_t>());
+		std::string Doubles = MakeTextDefault(MakeFloats<double>());
+
+		MeasureReferenceIn("strtol int32_t", Ints, [](const char* Begin, const char*) { Sink = strtol(Begin, nullptr, 10); });
+		MeasureReferenceIn("strtoull uint64_t", Longs, [](const char* Begin, const char*) { Sink = strtoull(Begin, nullptr, 10); });
+		MeasureReferenceIn("strtod double", Doubles, [](const char* Begin, const char*) { Sink = static_cast<size_t>(strtod(Begin, nullptr)); });
+
+		MeasureReferenceIn("from_chars int32_t", Ints, [](const char* Begin, const char* End) { int32_t Value = 0; std::from_chars(Begin, End, Value); Sink = Value; });
+		MeasureReferenceIn("from_chars uint64_t", Longs, [](const char* Begin, const char* End) { uint64_t Value = 0; std::from_chars(Begin, End, Value); Sink = Value; });
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+		MeasureReferenceIn("from_chars double", Doubles, [](const char* Begin, const char* End) { double Value = 0; std::from_chars(Begin, End, Value); Sink = static_cast<size_t>(Value); });
+#endif
+
+		// The position of an istream is not available at its end, so the bytes per operation are the average line length
+		std::istringstream IntStream(Ints), LongStream(Longs), DoubleStream(Doubles);
+		auto Rewind = [](std::istringstream& Stream, size_t Index) { if ((Index & (ValueCount - 1)) == 0) { Stream.clear(); Stream.seekg(0); } };
+		Measure("istringstream int32_t", [&](size_t Index) -> size_t { Rewind(IntStream, Index); int32_t Value = 0; IntStream >> Value; Sink = Value; return Ints.size() / ValueCount; });
+		Measure("istringstream uint64_t", [&](size_t Index) -> size_t { Rewind(LongStream, Index); uint64_t Value = 0; LongStream >> Value; Sink = Value; return Longs.size() / ValueCount; });
+		Measure("istringstream double", [&](size_t Index) -> size_t { Rewind(DoubleStream, Index); double Value = 0; DoubleStream >> Value; Sink = static_cast<size_t>(Value); return Doubles.size() / ValueCount; });
+	}
+
+}
+
+int main(int argc, char** argv)
+{
+	if (argc > 1)
+		CaseMillis = atof(argv[1]);
+	if (argc > 2)
+		Filter = argv[2];
+
+	AllOut<NullOutStream>("null");
+	AllOut<MemorySink>("memory");
+	ReferenceOut();
+	AllIn();
+	ReferenceIn();
+	ino::out.Flush();
+	return 0;
+}
@@ -0,0 +1,44 @@
+#include <Arduino.h>
+
+#include <IOStream.h>
+#include <JsonReader.h>
+
+// Expected input (sent in one line): {"baud": 9600, "gain": 1.5, "name": "sensor", "unused": [1, 2, 3]}
+
+static const char* const Keys[] = { "baud", "gain", "name" };
+
+unsigned long Baud = 0;
+float Gain = 0;
+char Name[16] = "";
+
+void setup() {
+	ino::out.begin(9600);
+	ino::in.begin(9600);
+
+	ino::JsonReader Json(ino::in);
+	ino::out << "Enter configuration: ";
+
+	if (Json.Next() != ino::JsonReader::Token::BeginObject)
+		return;
+	while (Json.Next() == ino::JsonReader::Token::Key)
+	{
+		switch (Json.ReadKey(Keys))
+		{
+		case 0: Json.Next(); Json.ReadNumber(Baud); break;
+		case 1: Json.Next(); Json.ReadNumber(Gain); break;
+		case 2: Json.Next(); Json.ReadString(Name, sizeof(Name)); break;
+		default: Json.Next(); Json.Skip(); break; // Skips unknown values, including whole objects and arrays
+		}
+	}
+
+	if (Json.Failed())
+		ino::out << ino::endl << "Malformed configuration" << ino::endl;
+	else
+		ino::out << ino::endl << "baud: " << Baud << ino::endl
+			<< "gain: " << Gain << ino::endl
+			<< "name: " << Name << ino::endl;
+}
+
+void loop() {
+
+}
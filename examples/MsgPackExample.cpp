@@ -0,0 +1,38 @@
+#include <Arduino.h>
+
+#include <IOStream.h>
+#include <MsgPackStream.h>
+#include <SpanInStream.h>
+#include <SpanOutStream.h>
+
+// Encodes one value of every fixed width (float32, float64, uint8 ... uint64, int8 ... int64), each followed by a marker
+// Skip() must step over the value exactly, so that the marker is read back after it
+
+char Buffer[128];
+const int Marker = 42;
+
+template <typename T>
+bool SkipsTo(T Value) {
+	ino::SpanOutStream Out(Buffer, sizeof(Buffer));
+	ino::MsgPackOut(Out) << Value << Marker;
+
+	ino::SpanInStream In(Buffer, Out.GetLength());
+	ino::MsgPackIn Unpack(In);
+	Unpack.Skip();
+	int Read = 0;
+	Unpack >> Read;
+	return !Unpack.Failed() && Read == Marker;
+}
+
+void setup() {
+	ino::out.begin(9600);
+
+	bool Passed = SkipsTo(1.5f) && SkipsTo(0.1)
+		&& SkipsTo(200u) && SkipsTo(1000u) && SkipsTo(70000ul) && SkipsTo(5000000000ull)
+		&& SkipsTo(-100) && SkipsTo(-1000) && SkipsTo(-70000l) && SkipsTo(-5000000000ll);
+	ino::out << "MsgPack skip: " << (Passed ? "ok" : "FAILED") << ino::endl;
+}
+
+void loop() {
+
+}